@@ -0,0 +1,36 @@
+#ifndef ARRIVAL_STREAM_H_
+#define ARRIVAL_STREAM_H_
+
+#include "process.h"
+
+//  An interface for sources of Processes which arrive while a simulation runs
+//  Unlike the jobs queue given to a ProcessManager up front, a stream only hands out
+//  each Process when the simulation reaches its arrival time and takes it back once it
+//  has terminated, so the simulation never needs the whole workload at once.
+//  The Processes of a stream arrive in order of their arrival times.
+class ArrivalStream {
+public:
+  //  Streams are destroyed through pointers to this interface
+  virtual ~ArrivalStream() {}
+
+  //  Finds the arrival time of the next Process of the stream
+  //  May wait until the next Process is available, e.g. while it is being read
+  //  Takes no inputs
+  //  Returns the arrival time of the next Process
+  //  Returns INT_MAX if the stream has no more Processes
+  virtual int NextArrival() = 0;
+
+  //  Removes the next Process from the stream
+  //  Should only be called after NextArrival returned its arrival time
+  //  Takes no inputs
+  //  Returns a pointer to the Process, in the "new" process state, which stays valid
+  //  until it is passed to Retire
+  virtual Process *Admit() = 0;
+
+  //  Gives back a Process which has terminated, which the simulation no longer uses
+  //  First input: A pointer to a Process returned by Admit
+  //  Returns nothing
+  virtual void Retire(Process *) = 0;
+};
+
+#endif  //  ARRIVAL_STREAM_H_
@@ -0,0 +1,343 @@
+#include "fcfs_scheduler.h"
+#include "mlfq_scheduler.h"
+#include "output_sink.h"
+#include "process.h"
+#include "process_manager.h"
+#include "scheduler.h"
+#include "scheduler_config.h"
+#include "simulation_arena.h"
+#include "sjf_scheduler.h"
+#include "srtf_scheduler.h"
+#include "workload.h"
+#include "workload_generator.h"
+
+#include <sys/resource.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+//  The number of calls to operator new since the program started
+static std::atomic<unsigned long long> allocation_count(0);
+
+//  Every allocation of the program is counted so that the allocations made by a
+//  simulation can be reported
+void *operator new(size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  void *memory = std::malloc(size > 0 ? size : 1);
+  if (memory == nullptr) throw std::bad_alloc();
+  return memory;
+}
+
+void *operator new[](size_t size) {
+  return ::operator new(size);
+}
+
+void operator delete(void *memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void *memory, size_t) noexcept {
+  std::free(memory);
+}
+
+//  A sink which prints nothing and only counts the events of a simulation
+class CountingSink : public OutputSink {
+public:
+  //  constructors
+  CountingSink() : events_(0) {}
+
+  //  methods
+  std::ostream *context_stream() { return nullptr; }
+  std::ostream *summary_stream() { return nullptr; }
+  bool records_events() const { return true; }
+  void Record(const EventRecord &) { ++this->events_; }
+  void Flush() {}
+
+  //  getters
+  unsigned long long events() const { return this->events_; }
+
+private:
+  unsigned long long events_;   //  the number of events recorded
+};
+
+//  The measurements of one scheduler on one workload
+struct BenchmarkResult {
+  string scheduler;                   //  the name of the scheduler configuration
+  size_t processes;                   //  the number of Processes in the workload
+  int runs;                           //  the number of times the simulation was repeated
+  double seconds;                     //  the wall time of one simulation
+  long long simulated_ticks;          //  the total time of one simulation
+  unsigned long long events;          //  the events of one simulation
+  unsigned long long allocations;     //  the allocations of one simulation
+  long peak_rss_kb;                   //  the peak resident set size of the process
+};
+
+//  Resets the peak resident set size of the process to its current size, so that the
+//  peak of each benchmark can be measured separately
+//  Takes no inputs
+//  Returns true if the peak could be reset (Linux only)
+static bool ResetPeakRSS() {
+  FILE *file = fopen("/proc/self/clear_refs", "w");
+  if (file == nullptr) return false;
+  bool ok = fputs("5", file) >= 0;
+  return fclose(file) == 0 && ok;
+}
+
+//  Finds the peak resident set size of the process
+//  Takes no inputs
+//  Returns the peak in KiB since the last ResetPeakRSS, or since the process started
+//  if it could not be reset
+static long PeakRSS() {
+  std::ifstream status("/proc/self/status");
+  string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 6, "VmHWM:") == 0) return std::atol(line.c_str() + 6);
+  }
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+//  How the simulation calls the scheduler
+//  kStaticDispatch uses a ProcessManager specialized for the scheduler class,
+//  kVirtualDispatch calls it through the Scheduler interface
+enum DispatchMode { kStaticDispatch, kVirtualDispatch };
+
+//  Simulates the jobs of an arena with a scheduler until at least min_seconds of
+//  simulation have been measured
+//  The ProcessManager is created once and every run rewinds it with Reset, so only
+//  the rewind and the simulation are measured
+//  First input: A pointer to the scheduler, owned by the arena
+//  Second input: A constant reference to the jobs queue of the arena
+//  Third input: The engine which advances the clock
+//  Fourth input: The minimum total wall time of the measured simulations in seconds
+//  Fifth input: A pointer to the measurements, whose runs, seconds, events, allocations
+//  and simulated_ticks are set
+//  Returns nothing
+template <typename SchedulerT>
+static void MeasureRuns(SchedulerT *scheduler, const vector<Process *> &jobs, EngineMode engine,
+  double min_seconds, BenchmarkResult *result) {
+  CountingSink sink;
+  BasicProcessManager<SchedulerT> simulator(jobs, scheduler, engine);
+  simulator.set_sink(&sink);
+
+  double total_seconds = 0.0;
+  unsigned long long total_events = 0;
+  unsigned long long total_allocations = 0;
+  while (result->runs == 0 || total_seconds < min_seconds) {
+    unsigned long long events = sink.events();
+    unsigned long long allocations = allocation_count.load(std::memory_order_relaxed);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    simulator.Reset();
+    simulator.SimulateScheduler();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    total_allocations += allocation_count.load(std::memory_order_relaxed) - allocations;
+
+    total_seconds += elapsed.count();
+    total_events += sink.events() - events;
+    result->simulated_ticks = simulator.result().total_time;
+    ++result->runs;
+  }
+  result->seconds = total_seconds / result->runs;
+  result->events = total_events / result->runs;
+  result->allocations = total_allocations / result->runs;
+}
+
+//  Simulates a workload with a scheduler configuration until at least min_seconds of
+//  simulation have been measured
+//  The Processes and the scheduler are created once in a SimulationArena, which is not
+//  measured, and rewound for every run
+//  First input: A constant reference to the workload
+//  Second input: A constant reference to the scheduler configuration
+//  Third input: How the simulation calls the scheduler
+//  Fourth input: The minimum total wall time of the measured simulations in seconds
+//  Returns the measurements of one simulation
+static BenchmarkResult Measure(const Workload &workload, const SchedulerConfig &config,
+  DispatchMode dispatch, double min_seconds) {
+  BenchmarkResult result;
+  result.scheduler = config.Name();
+  result.processes = workload.size();
+  result.runs = 0;
+  result.simulated_ticks = 0;
+  ResetPeakRSS();
+
+  SimulationArena arena(workload);
+  Scheduler *scheduler = arena.CreateScheduler(config);
+  const vector<Process *> &jobs = arena.jobs();
+  if (dispatch == kVirtualDispatch) {
+    MeasureRuns(scheduler, jobs, config.engine, min_seconds, &result);
+  } else {
+    switch (config.kind) {
+    case SchedulerKind::kFCFS:
+      MeasureRuns(static_cast<FCFSScheduler *>(scheduler), jobs, config.engine, min_seconds, &result);
+      break;
+    case SchedulerKind::kSJF:
+      MeasureRuns(static_cast<SJFScheduler *>(scheduler), jobs, config.engine, min_seconds, &result);
+      break;
+    case SchedulerKind::kMLFQ:
+      MeasureRuns(static_cast<MLFQScheduler *>(scheduler), jobs, config.engine, min_seconds, &result);
+      break;
+    case SchedulerKind::kSRTF:
+      MeasureRuns(static_cast<SRTFScheduler *>(scheduler), jobs, config.engine, min_seconds, &result);
+      break;
+    }
+  }
+  result.peak_rss_kb = PeakRSS();
+  return result;
+}
+
+//  Divides two measurements
+//  First input: The numerator
+//  Second input: The denominator
+//  Returns the quotient, or 0 if the denominator is not positive
+static double Rate(double numerator, double denominator) {
+  return denominator > 0.0 ? numerator / denominator : 0.0;
+}
+
+//  Prints the measurements as a JSON document
+//  First input: A constant reference to the measurements
+//  Second input: The engine which was benchmarked
+//  Third input: How the simulation called the scheduler
+//  Fourth input: The seed of the generated workloads
+//  Fifth input: A reference to the stream to print to
+//  Returns nothing
+static void PrintJSON(const vector<BenchmarkResult> &results, EngineMode engine,
+  DispatchMode dispatch, uint64_t seed, std::ostream &out) {
+  out << std::fixed << std::setprecision(6);
+  out << "{" << endl;
+  out << "  \"compiler\": \"" << __VERSION__ << "\"," << endl;
+#ifdef __OPTIMIZE__
+  out << "  \"optimized\": true," << endl;
+#else
+  out << "  \"optimized\": false," << endl;
+#endif
+#ifdef SIMULATION_COUNTERS
+  out << "  \"counters\": true," << endl;
+#else
+  out << "  \"counters\": false," << endl;
+#endif
+  out << "  \"engine\": \"" << (engine == kEventEngine ? "event" : "tick") << "\"," << endl;
+  out << "  \"dispatch\": \"" << (dispatch == kStaticDispatch ? "static" : "virtual") << "\","
+    << endl;
+  out << "  \"seed\": " << seed << "," << endl;
+  out << "  \"results\": [" << endl;
+  for (vector<BenchmarkResult>::size_type i = 0; i < results.size(); ++i) {
+    const BenchmarkResult &result = results[i];
+    out << "    { \"scheduler\": \"" << result.scheduler << "\""
+      << ", \"processes\": " << result.processes
+      << ", \"runs\": " << result.runs
+      << ", \"seconds\": " << result.seconds
+      << ", \"simulated_ticks\": " << result.simulated_ticks
+      << ", \"events\": " << result.events
+      << ", \"ticks_per_second\": " << Rate(result.simulated_ticks, result.seconds)
+      << ", \"events_per_second\": " << Rate(result.events, result.seconds)
+      << ", \"allocations\": " << result.allocations
+      << ", \"allocations_per_event\": " << Rate(result.allocations, result.events)
+      << ", \"peak_rss_kb\": " << result.peak_rss_kb << " }"
+      << (i + 1 < results.size() ? "," : "") << endl;
+  }
+  out << "  ]" << endl;
+  out << "}" << endl;
+}
+
+//  Parses a comma separated list of workload sizes
+//  First input: A pointer to the list
+//  Second input: A pointer to the vector which receives the sizes
+//  Returns true if every entry is a positive number
+static bool ParseSizes(const char *list, vector<size_t> *sizes) {
+  sizes->clear();
+  std::stringstream stream(list);
+  string entry;
+  while (std::getline(stream, entry, ',')) {
+    char *end = nullptr;
+    unsigned long long size = std::strtoull(entry.c_str(), &end, 10);
+    if (entry.empty() || *end != '\0' || size == 0) return false;
+    sizes->push_back(static_cast<size_t>(size));
+  }
+  return !sizes->empty();
+}
+
+//  Measures the throughput of the simulator for every scheduler over generated
+//  workloads of increasing size and prints the measurements as JSON
+//  Usage: RunBenchmark [-d static|virtual] [-e tick|event] [-n size,size,...] [-s seed]
+//  [-t seconds]
+//  Progress is printed to the standard error, so the output may be redirected to a
+//  file and compared with that of another build
+int main(int argc, char *argv[]) {
+  EngineMode engine = kEventEngine;
+  DispatchMode dispatch = kStaticDispatch;
+  vector<size_t> sizes = { 10, 1000, 100000, 1000000 };
+  uint64_t seed = 1;
+  double min_seconds = 0.5;
+  for (int i = 1; i < argc; ++i) {
+    string option = argv[i];
+    if (i + 1 < argc && option == "-d" && (strcmp(argv[i + 1], "static") == 0 ||
+      strcmp(argv[i + 1], "virtual") == 0)) {
+      dispatch = strcmp(argv[++i], "static") == 0 ? kStaticDispatch : kVirtualDispatch;
+    } else if (i + 1 < argc && option == "-e" && (strcmp(argv[i + 1], "tick") == 0 ||
+      strcmp(argv[i + 1], "event") == 0)) {
+      engine = strcmp(argv[++i], "tick") == 0 ? kTickEngine : kEventEngine;
+    } else if (i + 1 < argc && option == "-n" && ParseSizes(argv[i + 1], &sizes)) {
+      ++i;
+    } else if (i + 1 < argc && option == "-s") {
+      seed = std::strtoull(argv[++i], nullptr, 10);
+    } else if (i + 1 < argc && option == "-t") {
+      min_seconds = std::atof(argv[++i]);
+    } else {
+      cerr << "Usage: " << argv[0]
+        << " [-d static|virtual] [-e tick|event] [-n size,size,...] [-s seed] [-t seconds]"
+        << endl;
+      return 2;
+    }
+  }
+
+  vector<SchedulerConfig> configs;
+  SchedulerConfig fcfs = { SchedulerKind::kFCFS, engine, 1, 0, vector<int>(), 0 };
+  SchedulerConfig sjf = { SchedulerKind::kSJF, engine, 1, 0, vector<int>(), 0 };
+  SchedulerConfig mlfq = { SchedulerKind::kMLFQ, engine, 1, 0, vector<int>(), 0 };
+  SchedulerConfig srtf = { SchedulerKind::kSRTF, engine, 1, 0, vector<int>(), 0 };
+  configs.push_back(fcfs);
+  configs.push_back(sjf);
+  configs.push_back(mlfq);
+  configs.push_back(srtf);
+
+  vector<BenchmarkResult> results;
+  for (vector<size_t>::const_iterator size = sizes.begin(); size != sizes.end(); ++size) {
+    Workload workload;
+    WorkloadGenerator generator = WorkloadGenerator::InteractiveBatchMix(seed);
+    generator.Generate(*size, &workload);
+    for (vector<SchedulerConfig>::const_iterator config = configs.begin();
+      config != configs.end(); ++config) {
+      BenchmarkResult result = Measure(workload, *config, dispatch, min_seconds);
+      cerr << std::left << std::setw(16) << result.scheduler << std::right << std::setw(9)
+        << result.processes << " processes  " << std::setw(14) << std::fixed
+        << std::setprecision(0) << Rate(result.events, result.seconds) << " events/s" << endl;
+      results.push_back(result);
+    }
+  }
+  PrintJSON(results, engine, dispatch, seed, cout);
+  return 0;
+}
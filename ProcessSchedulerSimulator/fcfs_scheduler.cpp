@@ -1,9 +1,8 @@
 #include "fcfs_scheduler.h"
 #include "process.h"
 
-#include <iostream>
+#include <ostream>
 #include <vector>
-using std::cout;
 using std::endl;
 using std::vector;
 
@@ -12,8 +11,11 @@ FCFSScheduler::FCFSScheduler() {}
 
 //  A constructor for the FCFSScheduler class
 //  First input: A constant reference to a vector of pointers to Process objects,
-//  which represent the processes to be simulated
-FCFSScheduler::FCFSScheduler(const vector<Process *> &jobs) : ready_queue_(jobs) {}
+//  which represent the processes to be simulated, those in the "ready" process state
+//  start in the ready queue
+FCFSScheduler::FCFSScheduler(const vector<Process *> &jobs) {
+  this->Reset(jobs);
+}
 
 //  Adds a process to the ready queue
 //  First input: A pointer to the Process object to be added to the ready queue
@@ -27,26 +29,35 @@ void FCFSScheduler::AddProcess(Process *process) {
 //  Also sets response flag/response time for process if it is the first time
 //  entering "running" process state
 //  First input: an integer representing the current time of the process manager
-//  Returns nothing
-void FCFSScheduler::DispatchProcess(int current_time) {
-  //  if the ready queue is not empty
-  if (!this->ready_queue_.empty()) {
+//  Returns a pointer to the dispatched Process
+//  Returns nullptr if the ready queue is empty
+Process *FCFSScheduler::DispatchProcess(int current_time) {
+  //  if the ready queue is empty there is nothing to dispatch
+  if (this->ready_queue_.empty()) return nullptr;
 
-    //  if this is the first time the next Process has entered the "running" process state  
-    if (!this->ready_queue_.front()->response_flag()) {
-      //  set response flag to true
-      this->ready_queue_.front()->set_response_flag(true);
+  Process *next = this->ready_queue_.front();
 
-      //  set response time to current time
-      this->ready_queue_.front()->set_response_time(current_time);
-    }
+  //  if this is the first time the next Process has entered the "running" process state
+  if (!next->response_flag()) {
+    //  set response flag to true
+    next->set_response_flag(true);
 
-    //  set the next Process to "running" process state and erase it from ready queue
-    this->ready_queue_.front()->set_state("running");
-    this->ready_queue_.erase(this->ready_queue_.begin());
+    //  set response time to the time since the Process arrived
+    next->set_response_time(current_time - next->arrival_time());
   }
+
+  //  set the next Process to "running" process state and remove it from ready queue
+  next->set_state(ProcessState::kRunning);
+  this->ready_queue_.pop_front();
+  return next;
 }
 
+//  The FCFS Scheduler has a single ready queue, so every Process is dispatched
+//  from level 0
+//  Takes no inputs
+//  Always returns 0
+int FCFSScheduler::DispatchLevel() const { return 0; }
+
 //  The FCFS Scheduler does not have a round robin queue and hence
 //  does not need to do anything when ManageTimeQuantum is called.
 //  This is only implemented, because it is required by the Scheduler
@@ -63,18 +74,32 @@ void FCFSScheduler::ManageTimeQuantum(Process *running, bool &context_switch) {}
 //  Always returns false
 bool FCFSScheduler::Preemption(Process *running) const { return false; }
 
-//  Prints the ready queue to the console
-//  Takes no inputs
+//  The FCFS Scheduler does not have a round robin queue and hence the
+//  running Process is never subject to a time quantum. This is only implemented,
+//  because it is required by the Scheduler interface
+//  First input: A pointer to a Process object which is in the "running" process state
+//  Always returns -1
+int FCFSScheduler::QuantumRemaining(const Process *) const { return -1; }
+
+//  The FCFS Scheduler does not have a round robin queue and hence
+//  does not need to do anything when SkipTimeQuantum is called.
+//  This is only implemented, because it is required by the Scheduler
+//  interface.
+//  First input: An integer representing the number of ticks which have elapsed
+//  Returns nothing.
+void FCFSScheduler::SkipTimeQuantum(int) { }
+
+//  Prints the ready queue
+//  First input: A reference to the stream to print to
 //  Returns nothing
-//  Outputs the ready queue to the console
-void FCFSScheduler::PrintQueue() const {
-  cout << "Ready Queue:\tProcess\t\tBurst" << endl;
+void FCFSScheduler::PrintQueue(std::ostream &out) const {
+  out << "Ready Queue:\tProcess\t\tBurst" << endl;
   if (this->ready_queue_.begin() == this->ready_queue_.end())
-    cout << "\t\t[empty]" << endl;
+    out << "\t\t[empty]" << endl;
   else {
-    for (vector<Process *>::const_iterator it = this->ready_queue_.begin();
+    for (RingQueue<Process *>::const_iterator it = this->ready_queue_.begin();
       it != this->ready_queue_.end(); ++it) {
-      cout << "\t\t" << (*it)->name() << "\t\t" << (*it)->CurrentCPUTime() << endl;
+      out << "\t\t" << (*it)->name() << "\t\t" << (*it)->CurrentCPUTime() << endl;
     }
   }
 }
@@ -85,4 +110,34 @@ void FCFSScheduler::PrintQueue() const {
 //  Returns false if the ready queue is not empty
 bool FCFSScheduler::QueueEmpty() const {
   return this->ready_queue_.empty();
+}
+
+//  Counts the Processes in the ready queue for the FCFS scheduler
+//  Takes no inputs
+//  Returns the number of Processes in the ready queue
+int FCFSScheduler::QueueSize() const {
+  return static_cast<int>(this->ready_queue_.size());
+}
+
+//  Replaces the ready queue with the given Processes, keeping its capacity
+//  First input: A constant reference to a vector of pointers to Process objects, of
+//  which those in the "ready" process state are added to the ready queue in order
+//  Returns nothing
+void FCFSScheduler::Reset(const vector<Process *> &jobs) {
+  this->ready_queue_.clear();
+  this->ready_queue_.reserve(jobs.size());
+  for (vector<Process *>::const_iterator it = jobs.begin(); it != jobs.end(); ++it)
+    if ((*it)->state() == ProcessState::kReady) this->ready_queue_.push_back(*it);
+}
+
+//  Removes the Process at the back of the ready queue, which arrived last and
+//  would be dispatched last
+//  Takes no inputs
+//  Returns a pointer to the removed Process
+//  Returns nullptr if the ready queue is empty
+Process *FCFSScheduler::StealProcess() {
+  if (this->ready_queue_.empty()) return nullptr;
+  Process *process = this->ready_queue_.back();
+  this->ready_queue_.pop_back();
+  return process;
 }
\ No newline at end of file
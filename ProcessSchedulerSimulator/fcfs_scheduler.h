@@ -2,34 +2,44 @@
 #define FCFS_SCHEDULER_H_
 
 #include "process.h"
+#include "ring_queue.h"
 #include "scheduler.h"
 
 #include <vector>
 using std::vector;
 
 //  First Come First Serve Scheduler which implements the Scheduler interface
-class FCFSScheduler : public Scheduler {
+class FCFSScheduler final : public Scheduler {
 public:
+  static constexpr bool kHasQuantum = false;  //  no round robin queue
+  static constexpr bool kPreemptive = false;  //  never preempts
+
   //  constructors
   FCFSScheduler();
   FCFSScheduler(const vector<Process *> &);
 
   //  methods
   void AddProcess(Process *);
-  void DispatchProcess(int);
+  int DispatchLevel() const;
+  Process *DispatchProcess(int);
   void ManageTimeQuantum(Process *, bool &);    //  this method will do nothing  
   bool Preemption(Process *) const;             //  this method will always return false
-  void PrintQueue() const;
+  int QuantumRemaining(const Process *) const;  //  this method will always return -1
+  void SkipTimeQuantum(int);                      //  this method will do nothing
+  void PrintQueue(std::ostream &) const;
   bool QueueEmpty() const;
+  int QueueSize() const;
+  void Reset(const vector<Process *> &);
+  Process *StealProcess();
 
   //  getters
-  const vector<Process*> &ready_queue() const { return this->ready_queue_; }
+  const RingQueue<Process *> &ready_queue() const { return this->ready_queue_; }
 
   //  setters
-  void set_ready_queue(const vector<Process*> &ready_queue) { this->ready_queue_ = ready_queue; }
+  void set_ready_queue(const vector<Process*> &ready_queue) { this->ready_queue_.assign(ready_queue); }
 private:
   //  ready queue for the FCFS Scheduler
-  vector<Process *> ready_queue_;
+  RingQueue<Process *> ready_queue_;
 };
 
 #endif  //  FCFS_SCHEDULER_H_
\ No newline at end of file
@@ -17,6 +17,6 @@ struct APtrProcessComp {
   bool operator()(const Process *lhs, const Process *rhs) const {
     return lhs->priority() < rhs->priority();
   }
-} ProcessCmp;
+};
 
 #endif // FUNCTIONS_H_
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <iomanip>
+using std::endl;
+using std::setw;
+
+//  The number of buckets needed for every non-negative int
+static const int kBucketCount =
+  (32 - LatencyHistogram::kSubBucketBits + 1) << (LatencyHistogram::kSubBucketBits - 1);
+
+//  A constructor for the LatencyHistogram class
+//  Takes no inputs
+LatencyHistogram::LatencyHistogram() : buckets_(kBucketCount, 0), count_(0), sum_(0), max_(0) {}
+
+//  Finds the bucket which holds a value
+//  First input: A non-negative integer value
+//  Returns the index of the bucket
+int LatencyHistogram::BucketOf(int value) {
+  if (value < kSubBuckets) return value;
+  int shift = (31 - __builtin_clz(static_cast<unsigned>(value))) - (kSubBucketBits - 1);
+  return (shift << (kSubBucketBits - 1)) + (value >> shift);
+}
+
+//  Finds the highest value held by a bucket
+//  First input: The index of the bucket
+//  Returns the highest value, clamped to INT_MAX
+int LatencyHistogram::HighestInBucket(int bucket) {
+  if (bucket < kSubBuckets) return bucket;
+  int shift = (bucket >> (kSubBucketBits - 1)) - 1;
+  long long mantissa = bucket - (shift << (kSubBucketBits - 1));
+  long long highest = ((mantissa + 1) << shift) - 1;
+  return highest > INT_MAX ? INT_MAX : static_cast<int>(highest);
+}
+
+//  Adds a value to the histogram
+//  First input: An integer value (negative values are counted as 0)
+//  Returns nothing
+void LatencyHistogram::Add(int value) {
+  if (value < 0) value = 0;
+  ++this->buckets_[BucketOf(value)];
+  ++this->count_;
+  this->sum_ += value;
+  if (value > this->max_) this->max_ = value;
+}
+
+//  Removes every value from the histogram
+//  Takes no inputs
+//  Returns nothing
+void LatencyHistogram::Clear() {
+  std::fill(this->buckets_.begin(), this->buckets_.end(), 0);
+  this->count_ = 0;
+  this->sum_ = 0;
+  this->max_ = 0;
+}
+
+//  Adds every value of another histogram to this one
+//  First input: A constant reference to the other histogram
+//  Returns nothing
+void LatencyHistogram::Merge(const LatencyHistogram &other) {
+  for (int i = 0; i < kBucketCount; ++i) this->buckets_[i] += other.buckets_[i];
+  this->count_ += other.count_;
+  this->sum_ += other.sum_;
+  if (other.max_ > this->max_) this->max_ = other.max_;
+}
+
+//  Finds the value at or below which a given percentage of the values lie
+//  First input: The percentage, from 0 to 100
+//  Returns the highest value of the bucket holding that rank, no more than max,
+//  or 0 if the histogram is empty
+int LatencyHistogram::Percentile(double percent) const {
+  if (this->count_ == 0) return 0;
+  long long rank = static_cast<long long>(std::ceil(percent / 100.0 * this->count_));
+  if (rank < 1) rank = 1;
+  if (rank > this->count_) rank = this->count_;
+  long long seen = 0;
+  for (int i = 0; i < kBucketCount; ++i) {
+    seen += this->buckets_[i];
+    if (seen >= rank) return std::min(HighestInBucket(i), this->max_);
+  }
+  return this->max_;
+}
+
+//  Summarizes the values of the histogram
+//  Takes no inputs
+//  Returns the count, mean, percentiles and maximum of the values
+LatencySummary LatencyHistogram::Summarize() const {
+  LatencySummary summary;
+  summary.count = this->count_;
+  summary.mean = this->mean();
+  summary.p50 = this->Percentile(50.0);
+  summary.p90 = this->Percentile(90.0);
+  summary.p99 = this->Percentile(99.0);
+  summary.p999 = this->Percentile(99.9);
+  summary.max = this->max_;
+  return summary;
+}
+
+//  Prints the header of a table of latency summaries
+//  First input: A reference to the stream to print to
+//  Returns nothing
+void PrintLatencyHeader(std::ostream &out) {
+  std::ios::fmtflags flags = out.flags();
+  out << std::left << setw(12) << "" << std::right << setw(14) << "Mean" << setw(11) << "p50"
+    << setw(11) << "p90" << setw(11) << "p99" << setw(11) << "p99.9" << setw(11) << "Max" << endl;
+  out.flags(flags);
+}
+
+//  Prints one row of a table of latency summaries
+//  First input: A reference to the stream to print to
+//  Second input: A constant reference to a string holding the name of the row
+//  Third input: A constant reference to the summary
+//  Returns nothing
+void PrintLatencyRow(std::ostream &out, const string &name, const LatencySummary &summary) {
+  std::ios::fmtflags flags = out.flags();
+  std::streamsize precision = out.precision();
+  out << std::left << setw(12) << name << std::right << std::fixed << std::setprecision(2)
+    << setw(14) << summary.mean << setw(11) << summary.p50 << setw(11) << summary.p90
+    << setw(11) << summary.p99 << setw(11) << summary.p999 << setw(11) << summary.max << endl;
+  out.flags(flags);
+  out.precision(precision);
+}
@@ -0,0 +1,63 @@
+#ifndef LATENCY_HISTOGRAM_H_
+#define LATENCY_HISTOGRAM_H_
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+//  The summary of the values collected by a LatencyHistogram
+//  Percentiles are the highest value of the bucket which holds them, so they are at
+//  most 1/kSubBuckets above the exact value and never above max
+struct LatencySummary {
+  long long count;    //  the number of values
+  double mean;        //  the exact average of the values
+  int p50;            //  the median
+  int p90;            //  the 90th percentile
+  int p99;            //  the 99th percentile
+  int p999;           //  the 99.9th percentile
+  int max;            //  the exact largest value
+};
+
+//  A histogram of non-negative integer times in constant memory
+//  Values below kSubBuckets have a bucket each. Above that every power of two is split
+//  into kSubBuckets / 2 equal buckets (HDR-style log-linear buckets), so the relative
+//  error of a reported percentile is below 1/64 however many values are added.
+//  Negative values are counted as 0.
+class LatencyHistogram {
+public:
+  static const int kSubBucketBits = 7;                    //  log2 of kSubBuckets
+  static const int kSubBuckets = 1 << kSubBucketBits;     //  exact buckets below the first power of two split
+
+  //  constructors
+  LatencyHistogram();
+
+  //  methods
+  void Add(int);
+  void Clear();
+  void Merge(const LatencyHistogram &);
+  int Percentile(double) const;
+  LatencySummary Summarize() const;
+
+  //  getters
+  long long count() const { return this->count_; }
+  int max() const { return this->max_; }
+  double mean() const { return this->count_ > 0 ? static_cast<double>(this->sum_) / this->count_ : 0.0; }
+
+private:
+  static int BucketOf(int);
+  static int HighestInBucket(int);
+
+  vector<uint64_t> buckets_;  //  the number of values in each bucket
+  long long count_;           //  the number of values added
+  long long sum_;             //  the sum of the values added
+  int max_;                   //  the largest value added (0 if none)
+};
+
+//  printing of latency summaries as a table
+void PrintLatencyHeader(std::ostream &);
+void PrintLatencyRow(std::ostream &, const string &, const LatencySummary &);
+
+#endif  //  LATENCY_HISTOGRAM_H_
@@ -1,18 +1,105 @@
 #include "fcfs_scheduler.h"
 #include "mlfq_scheduler.h"
+#include "output_sink.h"
 #include "process.h"
 #include "process_manager.h"
+#include "scheduler_config.h"
+#include "simulation_arena.h"
 #include "sjf_scheduler.h"
+#include "srtf_scheduler.h"
+#include "workload.h"
+#include "workload_stream.h"
 
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <string>
 #include <vector>
+using std::cerr;
 using std::cout;
 using std::cin;
+using std::endl;
+using std::string;
 using std::vector;
 
-int main() {
-  bool running = true;
-  while (running) {
+//  Simulates a text workload while it is being read, without the menu
+//  The Processes are streamed from the file (or standard input) into the scheduler as
+//  they arrive, so workloads too large to load at once can be simulated
+//  First input: A constant reference to the path of the workload, "-" for standard input
+//  Second input: A constant reference to the configuration selecting the scheduler
+//  Third input: A pointer to the sink the output goes to (nullptr for console)
+//  Returns the exit status of the program
+static int RunOnline(const string &path, const SchedulerConfig &config, OutputSink *sink) {
+  WorkloadStream stream;
+  if (!stream.Open(path)) {
+    cerr << stream.error() << endl;
+    return 1;
+  }
+  vector<Process *> jobs;   //  the stream adds the Processes as they arrive
+  std::unique_ptr<Scheduler> scheduler(config.Create(jobs));
+  ProcessManager simulator(jobs, scheduler.get(), config.engine);
+  simulator.set_sink(sink);
+  simulator.set_stream(&stream);
+  simulator.SimulateScheduler();
+  if (!stream.error().empty()) {
+    cerr << path << ": " << stream.error() << endl;
+    return 1;
+  }
+  return 0;
+}
+
+//  Usage: RunProcessSimulator [-s | -l event_log] [-o fcfs|sjf|mlfq|srtf] [workload]
+//  -s prints only the statistics of each simulation, -l writes a binary event log
+//  of each simulation to the given file instead of printing
+//  -o simulates the text workload (standard input if none is given or it is "-") with
+//  the given scheduler while it is being read, instead of showing the menu
+int main(int argc, char *argv[]) {
+  Workload workload;
+  std::unique_ptr<OutputSink> sink;   //  nullptr for the default console output
+  string log_path;
+  string online;                      //  the scheduler of the online simulation, empty for the menu
+  int arg = 1;
+  for (; arg < argc && argv[arg][0] == '-' && argv[arg][1] != '\0'; ++arg) {
+    if (strcmp(argv[arg], "-s") == 0) {
+      sink.reset(new SummarySink(&cout));
+    } else if (strcmp(argv[arg], "-l") == 0 && arg + 1 < argc) {
+      log_path = argv[++arg];
+    } else if (strcmp(argv[arg], "-o") == 0 && arg + 1 < argc) {
+      online = argv[++arg];
+    } else {
+      cerr << "usage: " << argv[0] << " [-s | -l event_log] [-o fcfs|sjf|mlfq|srtf] [workload]" << endl;
+      return 1;
+    }
+  }
+
+  //  an online simulation streams the workload instead of loading it
+  if (!online.empty()) {
+    SchedulerConfig config = { SchedulerKind::kFCFS, kEventEngine, 1, 0, vector<int>(), 0 };
+    if (online == "sjf") config.kind = SchedulerKind::kSJF;
+    else if (online == "mlfq") config.kind = SchedulerKind::kMLFQ;
+    else if (online == "srtf") config.kind = SchedulerKind::kSRTF;
+    else if (online != "fcfs") {
+      cerr << online << ": unknown scheduler" << endl;
+      return 1;
+    }
+    if (!log_path.empty()) {
+      EventLogSink *log = new EventLogSink(log_path);
+      sink.reset(log);
+      if (!log->ok()) cerr << log_path << ": cannot be written" << endl;
+    }
+    return RunOnline(arg < argc ? argv[arg] : "-", config, sink.get());
+  }
+
+  //  if a workload file is given load the processes from it
+  if (arg < argc) {
+    if (!workload.Load(argv[arg])) {
+      cerr << argv[arg] << ": " << workload.error() << endl;
+      return 1;
+    }
+  }
+
+  //  otherwise simulate the default eight processes
+  else {
     //  CPU bursts for the processes
     vector<int> p1_cpu({ 4, 5, 3, 5, 4, 6, 4, 5, 2 });
     vector<int> p2_cpu({ 18, 19, 11, 18, 19, 18, 17, 19, 10 });
@@ -33,62 +120,94 @@ int main() {
     vector<int> p7_io({ 51, 53, 61, 31, 43 });
     vector<int> p8_io({ 52, 42, 31, 21, 43, 31, 32 });
 
+    //  Add the processes to the workload
+    workload.AddProcess("P1", 0, p1_cpu, p1_io);
+    workload.AddProcess("P2", 0, p2_cpu, p2_io);
+    workload.AddProcess("P3", 0, p3_cpu, p3_io);
+    workload.AddProcess("P4", 0, p4_cpu, p4_io);
+    workload.AddProcess("P5", 0, p5_cpu, p5_io);
+    workload.AddProcess("P6", 0, p6_cpu, p6_io);
+    workload.AddProcess("P7", 0, p7_cpu, p7_io);
+    workload.AddProcess("P8", 0, p8_cpu, p8_io);
+  }
+
+  //  every Process and scheduler lives in the arena, the Processes are created once and
+  //  rewound before each simulation, and the arena holds a single scheduler which is
+  //  reset instead of recreated when the same kind is simulated again
+  SimulationArena arena(workload);
+  const vector<Process *> &jobs = arena.jobs();
+
+  bool running = true;
+  while (running) {
     //  Initialize the processes
-    Process P1(p1_cpu, p1_io, "P1", "ready");
-    Process P2(p2_cpu, p2_io, "P2", "ready");
-    Process P3(p3_cpu, p3_io, "P3", "ready");
-    Process P4(p4_cpu, p4_io, "P4", "ready");
-    Process P5(p5_cpu, p5_io, "P5", "ready");
-    Process P6(p6_cpu, p6_io, "P6", "ready");
-    Process P7(p7_cpu, p7_io, "P7", "ready");
-    Process P8(p8_cpu, p8_io, "P8", "ready");
-
-    //  A vector of all processes
-    vector<Process *> jobs = { &P1, &P2, &P3, &P4, &P5, &P6, &P7, &P8 };
+    arena.Rewind();
 
     cout << "Process Scheduler Simulator\n\n";
     cout << "1. Shortest Job First Simulation\n";
     cout << "2. First Come First Server Simulation\n";
     cout << "3. Multi Level Feedback Queue Simulation\n";
-    cout << "4. Exit\n\n";
+    cout << "4. Shortest Remaining Time First Simulation\n";
+    cout << "5. Exit\n\n";
     cout << "Input: ";
 
     int input;
 
-    cin >> input;
+    //  stop at the end of the input instead of showing the menu forever
+    if (!(cin >> input)) break;
+
+    //  every simulation overwrites the event log of the previous one
+    if (!log_path.empty() && input >= 1 && input <= 4) {
+      EventLogSink *log = new EventLogSink(log_path);
+      sink.reset(log);
+      if (!log->ok()) cerr << log_path << ": cannot be written" << endl;
+    }
 
     switch (input) {
     case 1: {
-      //  A shortest job first scheduler which is passed the jobs list
-      SJFScheduler *sjf_scheduler = new SJFScheduler(jobs);
+      //  A shortest job first scheduler for the jobs list, reused if the last simulation had one
+      SJFScheduler *sjf_scheduler = arena.ReuseScheduler<SJFScheduler>();
 
       //  A process manager which is passed the jobs list and the scheduler to be simulated
-      ProcessManager simulator(jobs, sjf_scheduler);
+      BasicProcessManager<SJFScheduler> simulator(jobs, sjf_scheduler);
+      simulator.set_sink(sink.get());
 
       //  Run the simulation
       simulator.SimulateScheduler();
     } break;
     case 2: {
-      //  A first come first serve scheduler which is passed the jobs list
-      FCFSScheduler *fcfs_scheduler = new FCFSScheduler(jobs);
+      //  A first come first serve scheduler for the jobs list, reused if the last simulation had one
+      FCFSScheduler *fcfs_scheduler = arena.ReuseScheduler<FCFSScheduler>();
 
       //  A process manager which is passed the jobs list and the scheduler to be simulated
-      ProcessManager simulator(jobs, fcfs_scheduler);
+      BasicProcessManager<FCFSScheduler> simulator(jobs, fcfs_scheduler);
+      simulator.set_sink(sink.get());
 
       //  Run the simulation
       simulator.SimulateScheduler();
     } break;
     case 3: {
-      //  A multilevel feedback queue which is passed the jobs list
-      MLFQScheduler *mlfq_scheduler = new MLFQScheduler(jobs);
+      //  A multilevel feedback queue for the jobs list, reused if the last simulation had one
+      MLFQScheduler *mlfq_scheduler = arena.ReuseScheduler<MLFQScheduler>();
 
       //  A process manager which is passed the jobs list and the scheduler to be simulated
-      ProcessManager simulator(jobs, mlfq_scheduler);
+      BasicProcessManager<MLFQScheduler> simulator(jobs, mlfq_scheduler);
+      simulator.set_sink(sink.get());
       
       //  Run the simulation
       simulator.SimulateScheduler();
     } break;
     case 4: {
+      //  A shortest remaining time first scheduler for the jobs list, reused if the last simulation had one
+      SRTFScheduler *srtf_scheduler = arena.ReuseScheduler<SRTFScheduler>();
+
+      //  A process manager which is passed the jobs list and the scheduler to be simulated
+      BasicProcessManager<SRTFScheduler> simulator(jobs, srtf_scheduler);
+      simulator.set_sink(sink.get());
+
+      //  Run the simulation
+      simulator.SimulateScheduler();
+    } break;
+    case 5: {
       running = false;
     } break;
     }
@@ -1,97 +1,147 @@
 #include "mlfq_scheduler.h"
 #include "process.h"
 
-#include <iostream>
+#include <ostream>
 #include <vector>
-using std::cout;
 using std::endl;
 using std::vector;
 
 //  A default constructor for the MLFQScheduler class
-MLFQScheduler::MLFQScheduler() {}
+//  Uses the default shape of DefaultQuanta() with no priority boost
+MLFQScheduler::MLFQScheduler()
+  : nonempty_(0), boost_interval_(0), ticks_since_boost_(0), time_quantum_(0),
+    dispatch_level_(0) {
+  this->SetQuanta(MLFQScheduler::DefaultQuanta());
+}
 
 //  A constructor for the MLFQScheduler class
+//  Uses the default shape of DefaultQuanta() with no priority boost
 //  First input: A constant reference to a vector of pointers to Process objects,
-//  which represent the processes to be simulated
-MLFQScheduler::MLFQScheduler(const vector<Process *> & jobs) 
-  : high_priority_rr_queue_(jobs) {
-  //  For each Process in the initial highest priority ready queue
-  //  set that Process' priority to 1
-  for (vector<Process *>::iterator it = this->high_priority_rr_queue_.begin();
-    it != this->high_priority_rr_queue_.end(); ++it)
-    (*it)->set_priority(1);
+//  which represent the processes to be simulated, those in the "ready" process state
+//  start at level 0
+MLFQScheduler::MLFQScheduler(const vector<Process *> &jobs)
+  : nonempty_(0), boost_interval_(0), ticks_since_boost_(0), time_quantum_(0),
+    dispatch_level_(0) {
+  this->SetQuanta(MLFQScheduler::DefaultQuanta());
+  this->Reset(jobs);
+}
+
+//  A constructor for the MLFQScheduler class
+//  First input: A constant reference to a vector of pointers to Process objects,
+//  which represent the processes to be simulated, those in the "ready" process state
+//  start at level 0
+//  Second input: A constant reference to a vector of the time quantum of each level,
+//  highest priority first, where 0 or less makes the level a FCFS queue
+//  At most kMaxLevels levels are used and no levels selects DefaultQuanta()
+//  Third input: The number of ticks between priority boosts, 0 or less for none
+MLFQScheduler::MLFQScheduler(const vector<Process *> &jobs, const vector<int> &quanta,
+  int boost_interval)
+  : nonempty_(0), boost_interval_(boost_interval), ticks_since_boost_(0), time_quantum_(0),
+    dispatch_level_(0) {
+  this->SetQuanta(quanta.empty() ? MLFQScheduler::DefaultQuanta() : quanta);
+  this->Reset(jobs);
+}
+
+//  The time quanta of the default shape: two round robin queues (Tq = 6, Tq = 11)
+//  above a FCFS queue
+//  Takes no inputs
+//  Returns a vector of the time quantum of each level
+vector<int> MLFQScheduler::DefaultQuanta() {
+  vector<int> quanta;
+  quanta.push_back(6);
+  quanta.push_back(11);
+  quanta.push_back(0);
+  return quanta;
+}
+
+//  Sets the levels of the scheduler, one per time quantum, and empties every queue
+//  First input: A constant reference to a vector of the time quantum of each level
+//  Returns nothing
+void MLFQScheduler::SetQuanta(const vector<int> &quanta) {
+  this->quanta_.assign(quanta.begin(),
+    quanta.size() > kMaxLevels ? quanta.begin() + kMaxLevels : quanta.end());
+  this->queues_.assign(this->quanta_.size(), RingQueue<Process *>());
+  this->nonempty_ = 0;
+}
+
+//  Replaces the contents of the queue of a level
+//  The priority of every Process is set to that of the level
+//  First input: The level, 0 being the highest priority
+//  Second input: A constant reference to a vector of pointers to the Processes to queue
+//  Returns nothing
+void MLFQScheduler::set_queue(int level, const vector<Process *> &processes) {
+  for (vector<Process *>::const_iterator it = processes.begin(); it != processes.end(); ++it)
+    (*it)->set_priority(level + 1);
+  this->queues_[level].assign(processes);
+  if (processes.empty()) this->nonempty_ &= ~(1ULL << level);
+  else this->nonempty_ |= 1ULL << level;
+}
+
+//  Determines the level a Process belongs to from its priority
+//  Priorities beyond the number of levels belong to the lowest level
+//  First input: A constant pointer to the Process
+//  Returns the level, 0 being the highest priority
+int MLFQScheduler::LevelOf(const Process *process) const {
+  int priority = process->priority();
+  if (priority < 1) return 0;
+  if (priority > this->levels()) return this->levels() - 1;
+  return priority - 1;
 }
 
 //  Adds a process to the ready queue taking priority into account
+//  The priority of the Process is incremented first, so a Process whose priority was
+//  reset to 0 enters level 0 and a Process whose quantum expired moves down one level
 //  First input: A pointer to the Process object to be added to the ready queue
-//  Priority 1 Processes are added to the highest priority round robin (Tq=6) queue
-//  Priority 2 Processes are added to the lower priority round robin (Tq=11) queue
-//  Priority greater than 2 are added to the lowest priority FCFS queue
 //  Returns nothing
 void MLFQScheduler::AddProcess(Process *process) {
-  //  increment the priority of the Process
-  process->set_priority(process->priority() + 1);
+  //  increment the priority of the Process, the lowest level keeps its Processes
+  if (process->priority() < this->levels()) process->set_priority(process->priority() + 1);
 
-  //  if the Process has a priority of 1 add it to the highest
-  //  priority ready queue
-  if (process->priority() == 1)
-    this->high_priority_rr_queue_.push_back(process);
-
-  //  if the Process has a priority of 2 add it to the lower (teir 2)
-  //  priority ready queue
-  else if (process->priority() == 2)
-    this->low_priority_rr_queue_.push_back(process);
-
-  //  otherwise add the Process to the lowest priority FCFS ready queue
-  else
-    this->fcfs_queue_.push_back(process);
+  int level = this->LevelOf(process);
+  this->queues_[level].push_back(process);
+  this->nonempty_ |= 1ULL << level;
 }
 
 //  Dispatches the next Process in the ready queue with the highest priority
+//  The highest level which is not empty is found with a single find-first-set on the
+//  bitmap of non-empty levels, so dispatch does not depend on the number of levels
 //  Changes the state of the of the dispatched process from "ready" to "running"
 //  Also sets response flag/response time for process if it is the first time
 //  entering "running" process state
 //  First input: an integer representing the current time of the process manager
-//  Returns nothing
-void MLFQScheduler::DispatchProcess(int current_time) {
-  //  if a Process exists in the highest priority ready queue
-  if (!this->high_priority_rr_queue_.empty()) {
-    //  if this is the first time the next Process has entered the "running" process state
-    if (!this->high_priority_rr_queue_.front()->response_flag()) {
-      //  set response flag to true
-      this->high_priority_rr_queue_.front()->set_response_flag(true);
-
-      //  set response time to the current time
-      this->high_priority_rr_queue_.front()->set_response_time(current_time);
-    }
-    //  set the Process state to "running" and erase it from ready queue
-    this->high_priority_rr_queue_.front()->set_state("running");
-    this->high_priority_rr_queue_.erase(this->high_priority_rr_queue_.begin());
-
-    //  set current time quantum to 6
-    this->set_time_quantum(6);
-  } 
-  
-  //  else if a Process exists in the lower priority round robin ready queue
-  else if (!this->low_priority_rr_queue_.empty()) {
-    //  set the Process state to "running" and erase it from ready queue
-    this->low_priority_rr_queue_.front()->set_state("running");
-    this->low_priority_rr_queue_.erase(this->low_priority_rr_queue_.begin());
-
-    //  set current time quantum to 11
-    this->set_time_quantum(11);
-  } 
-  
-  //  else if a Process exists in the lowest priority FCFS ready queue
-  else if (!this->fcfs_queue_.empty()) {
-    //  set the Process state to "running" and erase it from ready queue
-    this->fcfs_queue_.front()->set_state("running");
-    this->fcfs_queue_.erase(this->fcfs_queue_.begin());
+//  Returns a pointer to the dispatched Process
+//  Returns nullptr if all of the ready queues are empty
+Process *MLFQScheduler::DispatchProcess(int current_time) {
+  if (this->nonempty_ == 0) return nullptr;
+  int level = __builtin_ctzll(this->nonempty_);
+  RingQueue<Process *> &queue = this->queues_[level];
+  Process *next = queue.front();
+  queue.pop_front();
+  if (queue.empty()) this->nonempty_ &= ~(1ULL << level);
+
+  //  if this is the first time the next Process has entered the "running" process state
+  if (!next->response_flag()) {
+    next->set_response_flag(true);
+    next->set_response_time(current_time - next->arrival_time());
   }
+
+  //  set the Process state to "running" and start the time quantum of its level
+  next->set_state(ProcessState::kRunning);
+  this->time_quantum_ = this->quanta_[level] > 0 ? this->quanta_[level] : 0;
+  this->dispatch_level_ = level;
+  return next;
+}
+
+//  Finds the level the last Process returned by DispatchProcess came from
+//  Takes no inputs
+//  Returns the level, 0 being the highest priority
+int MLFQScheduler::DispatchLevel() const {
+  return this->dispatch_level_;
 }
 
 //  Decrements the current time remaining for a running process in a round robin queue
 //  and checks to see if a context switch is necessary
+//  Also boosts the priority of every Process once the boost interval has elapsed
 //  First input: A pointer to the Process which is currently in the "running" state
 //  Second input: A reference to a bool which is the context switch flag
 //  Returns nothing
@@ -101,14 +151,14 @@ void MLFQScheduler::ManageTimeQuantum(Process *running, bool &context_switch) {
 
   //  if there exists a Process in the "running" process state which is from a round robin ready queue
   //  and time quantum has reached zero then a context switch is needed
-  if (this->time_quantum_ == 0 && running != nullptr && running->priority() <= 2) {
+  if (this->time_quantum_ == 0 && running != nullptr && this->quanta_[this->LevelOf(running)] > 0) {
     //  set context switch flag to true
     context_switch = true;
 
     //  if the "running" Process has not completed the current CPU burst then
     //  set its process state to "ready" and add it to the ready queue
     if (running->CurrentCPUTime() != 0) {
-      running->set_state("ready");
+      running->set_state(ProcessState::kReady);
       this->AddProcess(running);
     } 
     
@@ -119,23 +169,54 @@ void MLFQScheduler::ManageTimeQuantum(Process *running, bool &context_switch) {
 
       //  if the Process has more IO bursts to complete set its process state to "waiting"
       if (running->HasIO()) {
-        running->set_state("waiting");
+        running->set_state(ProcessState::kWaiting);
       }
       
       //  else if the Process has more CPU bursts to complete then set the process state to
       //  "ready" and add it to the ready queue
       else if (running->HasCPU()) {
-        running->set_state("ready");
+        running->set_state(ProcessState::kReady);
         this->AddProcess(running);
       } 
       
       //  else the Process has no more CPU bursts or IO bursts and should have its process state
       //  set to "terminated"
       else {
-        running->set_state("terminated");
+        running->set_state(ProcessState::kTerminated);
       }
     }
   }
+
+  //  once the boost interval has elapsed move every Process back to the highest priority
+  if (this->boost_interval_ > 0 && ++this->ticks_since_boost_ >= this->boost_interval_) {
+    this->Boost(running != nullptr && running->state() == ProcessState::kRunning ?
+      running : nullptr);
+    this->ticks_since_boost_ = 0;
+  }
+}
+
+//  Moves every "ready" Process to the queue of level 0, keeping the order of the
+//  levels and of the Processes within them, and sets their priority to 1
+//  A "running" Process below level 0 is boosted as well and starts a fresh time
+//  quantum of level 0
+//  First input: A pointer to the Process in the "running" state (nullptr if none)
+//  Returns nothing
+void MLFQScheduler::Boost(Process *running) {
+  RingQueue<Process *> &top = this->queues_[0];
+  for (uint64_t lower = this->nonempty_ & ~1ULL; lower != 0; lower &= lower - 1) {
+    RingQueue<Process *> &queue = this->queues_[__builtin_ctzll(lower)];
+    for (RingQueue<Process *>::const_iterator it = queue.begin(); it != queue.end(); ++it) {
+      (*it)->set_priority(1);
+      top.push_back(*it);
+    }
+    queue.clear();
+  }
+  this->nonempty_ = top.empty() ? 0 : 1;
+
+  if (running != nullptr && this->LevelOf(running) > 0) {
+    running->set_priority(1);
+    this->time_quantum_ = this->quanta_[0] > 0 ? this->quanta_[0] : 0;
+  }
 }
 
 //  Determines whether a preemption is needed, which occurs when a Process
@@ -144,50 +225,64 @@ void MLFQScheduler::ManageTimeQuantum(Process *running, bool &context_switch) {
 //  Returns true if a preemptive context switch is necessary
 //  Returns false if preemptive context switch is not necessary
 bool MLFQScheduler::Preemption(Process *running) const {
+  if (running == nullptr) return false;
 
-  //  if the current Procces has a priority greater than 2 and a Process
-  //  exists in a queue with a higher priority (priority = 1 or priority = 2)
-  //  then preemption is needed return true
-  if ((running != nullptr && running->priority() > 2) &&
-    (!this->high_priority_rr_queue_.empty() || !this->low_priority_rr_queue_.empty()))
-    return true;
+  //  preempt if any level above the level of the running Process is not empty
+  uint64_t higher = (1ULL << this->LevelOf(running)) - 1;
+  return (this->nonempty_ & higher) != 0;
+}
 
-  //  else if the current Process has a priority of 2 and a Process
-  //  exists in the highest priority queue (priority = 1)
-  //  then preemption is needed return true
-  else if ((running != nullptr && running->priority() == 2) &&
-    !this->high_priority_rr_queue_.empty())
-    return true;
+//  Determines how many ticks remain before ManageTimeQuantum changes the schedule,
+//  which is when the time quantum of a running round robin Process expires or when
+//  the priorities are next boosted
+//  First input: A pointer to a Process which is in the "running" state (nullptr if none)
+//  Returns the number of ticks until ManageTimeQuantum may force a context switch
+//  Returns -1 if neither applies, e.g. the running Process is from a FCFS level
+//  and priority boosts are disabled
+int MLFQScheduler::QuantumRemaining(const Process *running) const {
+  int remaining = -1;
+  if (running != nullptr && this->quanta_[this->LevelOf(running)] > 0 && this->time_quantum_ > 0)
+    remaining = this->time_quantum_;
+  if (this->boost_interval_ > 0) {
+    int boost = this->boost_interval_ - this->ticks_since_boost_;
+    if (remaining == -1 || boost < remaining) remaining = boost;
+  }
+  return remaining;
+}
 
-  //  else there is no preemption return false
-  else
-    return false;
+//  Decrements the time remaining on the time quantum and until the next boost by
+//  several ticks at once
+//  The caller guarantees that neither the time quantum of a running round robin
+//  Process expires nor a boost is due during the skipped ticks
+//  First input: An integer representing the number of ticks which have elapsed
+//  Returns nothing
+void MLFQScheduler::SkipTimeQuantum(int ticks) {
+  this->time_quantum_ -= ticks;
+  if (this->boost_interval_ > 0) this->ticks_since_boost_ += ticks;
 }
 
-//  Prints a given queue to the console
-//  First input: A constant reference to a vector of pointers to Process objects,
+//  Prints a given queue
+//  First input: A reference to the stream to print to
+//  Second input: A constant reference to a ring queue of pointers to Process objects,
 //  which represent the queue to be printed
 //  Returns nothing
-//  Outputs the input queue to the console
-void MLFQScheduler::PrintAQueue(const vector<Process *> &queue) const {
+void MLFQScheduler::PrintAQueue(std::ostream &out, const RingQueue<Process *> &queue) const {
   if (queue.begin() == queue.end())
-    cout << "\t\t[empty]" << endl;
+    out << "\t\t[empty]" << endl;
   else {
-    for (vector<Process *>::const_iterator it = queue.begin(); it != queue.end(); ++it)
-      cout << "\t\t" << (*it)->name() << "\t\t" << (*it)->CurrentCPUTime() << endl;
-  } cout << endl;
+    for (RingQueue<Process *>::const_iterator it = queue.begin(); it != queue.end(); ++it)
+      out << "\t\t" << (*it)->name() << "\t\t" << (*it)->CurrentCPUTime() << endl;
+  } out << endl;
 }
 
 //  Prints the ready queues for the MLFQ scheduler
-//  Takes not inputs
+//  First input: A reference to the stream to print to
 //  Returns nothing
-void MLFQScheduler::PrintQueue() const {
-  cout << "Ready Queue 1:\tProcess\t\tBurst" << endl;
-  this->PrintAQueue(this->high_priority_rr_queue_);
-  cout << "Ready Queue 2:\tProcess\t\tBurst" << endl;
-  this->PrintAQueue(this->low_priority_rr_queue_);
-  cout << "Ready Queue 3:\tProcess\t\tBurst" << endl;
-  this->PrintAQueue(this->fcfs_queue_);
+void MLFQScheduler::PrintQueue(std::ostream &out) const {
+  for (int level = 0; level < this->levels(); ++level) {
+    out << "Ready Queue " << level + 1 << ":\tProcess\t\tBurst" << endl;
+    this->PrintAQueue(out, this->queues_[level]);
+  }
 }
 
 //  Determines whether the ready queues are all empty
@@ -195,7 +290,53 @@ void MLFQScheduler::PrintQueue() const {
 //  Returns true if all of the scheduler's ready queues are empty
 //  Returns false if any of the scheduler's ready queue are not empty
 bool MLFQScheduler::QueueEmpty() const {
-  return (this->high_priority_rr_queue_.empty() &&
-    this->low_priority_rr_queue_.empty() &&
-    this->fcfs_queue_.empty());
+  return this->nonempty_ == 0;
+}
+
+//  Counts the Processes in all of the ready queues for the MLFQ scheduler
+//  Takes no inputs
+//  Returns the number of Processes in the ready queues
+int MLFQScheduler::QueueSize() const {
+  size_t size = 0;
+  for (uint64_t levels = this->nonempty_; levels != 0; levels &= levels - 1)
+    size += this->queues_[__builtin_ctzll(levels)].size();
+  return static_cast<int>(size);
+}
+
+//  Empties every level, restarts the time quantum and the priority boost and queues the
+//  given Processes at level 0, keeping the shape and the capacity of every queue
+//  First input: A constant reference to a vector of pointers to Process objects, of
+//  which those in the "ready" process state are added to level 0 in order
+//  Returns nothing
+void MLFQScheduler::Reset(const vector<Process *> &jobs) {
+  for (vector<RingQueue<Process *> >::iterator it = this->queues_.begin(); it != this->queues_.end(); ++it)
+    it->clear();
+  this->nonempty_ = 0;
+  this->ticks_since_boost_ = 0;
+  this->time_quantum_ = 0;
+  this->dispatch_level_ = 0;
+  RingQueue<Process *> &queue = this->queues_[0];
+  queue.reserve(jobs.size());
+  for (vector<Process *>::const_iterator it = jobs.begin(); it != jobs.end(); ++it) {
+    if ((*it)->state() != ProcessState::kReady) continue;
+    (*it)->set_priority(1);
+    queue.push_back(*it);
+  }
+  if (!queue.empty()) this->nonempty_ |= 1ULL;
+}
+
+//  Removes the Process at the back of the lowest priority ready queue which is not empty
+//  The priority of the Process is set so that AddProcess returns it to the same level
+//  Takes no inputs
+//  Returns a pointer to the removed Process
+//  Returns nullptr if all of the ready queues are empty
+Process *MLFQScheduler::StealProcess() {
+  if (this->nonempty_ == 0) return nullptr;
+  int level = 63 - __builtin_clzll(this->nonempty_);
+  RingQueue<Process *> &queue = this->queues_[level];
+  Process *process = queue.back();
+  queue.pop_back();
+  if (queue.empty()) this->nonempty_ &= ~(1ULL << level);
+  process->set_priority(level);
+  return process;
 }
\ No newline at end of file
@@ -2,43 +2,71 @@
 #define MLFQ_SCHEDULER_H_
 
 #include "process.h"
+#include "ring_queue.h"
 #include "scheduler.h"
 
+#include <cstdint>
 #include <vector>
 using std::vector;
 
 //  A Multilevel Feedback Queue Scheduler which implements the Scheduler interface
-class MLFQScheduler : public Scheduler {
+//  The scheduler has up to kMaxLevels ready queues. Level 0 has the highest priority
+//  and a Process at level i has a priority of i + 1. Each level is a round robin
+//  queue with its own time quantum, or a FCFS queue if its quantum is 0 or less.
+//  A Process whose quantum expires moves down one level, and every boost interval
+//  all Processes are moved back to level 0 so that long running Processes are not
+//  starved. The default shape is two round robin queues (Tq = 6, Tq = 11) above a
+//  FCFS queue with no priority boost.
+class MLFQScheduler final : public Scheduler {
 public:
+  static constexpr bool kHasQuantum = true;   //  round robin levels and priority boosts
+  static constexpr bool kPreemptive = true;   //  higher levels preempt lower ones
+  static const int kMaxLevels = 64;   //  the number of bits in the non-empty level bitmap
+
   //  constructors
   MLFQScheduler();
   MLFQScheduler(const vector<Process *> &);
+  MLFQScheduler(const vector<Process *> &, const vector<int> &, int);
 
   //  methods
   void AddProcess(Process *);
-  void DispatchProcess(int);
+  static vector<int> DefaultQuanta();
+  int DispatchLevel() const;
+  Process *DispatchProcess(int);
   void ManageTimeQuantum(Process *, bool &);
   bool Preemption(Process *) const;
-  void PrintAQueue(const vector<Process *> &) const;
-  void PrintQueue() const;
+  void PrintAQueue(std::ostream &, const RingQueue<Process *> &) const;
+  void PrintQueue(std::ostream &) const;
   bool QueueEmpty() const;
+  int QueueSize() const;
+  void Reset(const vector<Process *> &);
+  Process *StealProcess();
+  int QuantumRemaining(const Process *) const;
+  void SkipTimeQuantum(int);
 
   //  getters
-  const vector<Process *> &fcfs_queue() const { return this->fcfs_queue_; }
-  const vector<Process *> &low_priority_queue() const { return this->low_priority_rr_queue_; }
-  const vector<Process *> &ready_queue() const { return this->high_priority_rr_queue_; }
+  int boost_interval() const { return this->boost_interval_; }
+  int levels() const { return static_cast<int>(this->queues_.size()); }
+  int quantum(int level) const { return this->quanta_[level]; }
+  const vector<int> &quanta() const { return this->quanta_; }
+  const RingQueue<Process *> &queue(int level) const { return this->queues_[level]; }
   int time_quantum() const { return this->time_quantum_; }
 
   //  setters
-  void set_fcfs_queue(const vector<Process *> &q) { this->fcfs_queue_ = q; }
-  void set_low_priority_queue(const vector<Process *> &q) { this->low_priority_rr_queue_ = q; }
-  void set_ready_queue(const vector<Process *> &q) { this->high_priority_rr_queue_ = q; }
+  void set_queue(int, const vector<Process *> &);
   void set_time_quantum(int time) { this->time_quantum_ = time; }
 private:
-  vector<Process *> high_priority_rr_queue_;  //  Highest priority round robin queue (Tq = 6)
-  vector<Process *> low_priority_rr_queue_;   //  Lower priority round robin queue (Tq = 11)
-  vector<Process *> fcfs_queue_;              //  Lowest priority fcfs queue
-  int time_quantum_;                          //  An integer to hold the remaining time left of time quantum
+  void Boost(Process *);
+  int LevelOf(const Process *) const;
+  void SetQuanta(const vector<int> &);
+
+  vector<RingQueue<Process *> > queues_;  //  the ready queue of each level, highest priority first
+  vector<int> quanta_;                    //  the time quantum of each level (0 or less for FCFS)
+  uint64_t nonempty_;                     //  bit i is set when the queue of level i is not empty
+  int boost_interval_;                    //  ticks between priority boosts (0 or less for none)
+  int ticks_since_boost_;                 //  ticks elapsed since the last priority boost
+  int time_quantum_;                      //  An integer to hold the remaining time left of time quantum
+  int dispatch_level_;                    //  the level of the last dispatched Process
 };
 
-#endif  //  MLFQ_SCHEDULER_H_
\ No newline at end of file
+#endif  //  MLFQ_SCHEDULER_H_
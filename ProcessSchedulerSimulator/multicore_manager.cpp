@@ -0,0 +1,503 @@
+#include "multicore_manager.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <iostream>
+using std::cout;
+using std::endl;
+using std::sort;
+
+//  Orders Processes by id, which is their position in the jobs queue
+static bool IdLess(const Process *lhs, const Process *rhs) {
+  return lhs->id() < rhs->id();
+}
+
+//  A Constructor for the MultiCoreManager class
+//  The jobs are given to the CPUs in turn and every CPU gets its own scheduler
+//  First input: A constant reference to a vector of Process pointers to each
+//  of the Processes to be simulated
+//  Second input: A constant reference to the configuration, which selects the kind of
+//  scheduler, the engine, the number of CPUs and the migration cost
+MultiCoreManager::MultiCoreManager(const vector<Process *> &jobs, const SchedulerConfig &config)
+  : jobs_(jobs), config_(config), terminated_count_(0), next_arrival_(0), steal_count_(0), sink_(nullptr),
+    record_events_(false), result_() {
+  this->set_sink(nullptr);
+  int core_count = config.cores > 1 ? config.cores : 1;
+  vector<vector<Process *> > run_queues(core_count);
+  this->core_of_.resize(jobs.size());
+  for (vector<Process *>::size_type i = 0; i < jobs.size(); ++i) {
+    jobs[i]->set_id(static_cast<int>(i));
+    this->core_of_[i] = static_cast<int>(i % core_count);
+    run_queues[i % core_count].push_back(jobs[i]);
+    if (jobs[i]->state() == ProcessState::kNew) this->arrivals_.push_back(jobs[i]);
+  }
+  std::stable_sort(this->arrivals_.begin(), this->arrivals_.end(),
+    [](const Process *lhs, const Process *rhs) { return lhs->arrival_time() < rhs->arrival_time(); });
+  this->waiting_.Clear(static_cast<int>(jobs.size()));
+
+  this->cores_.resize(core_count);
+  for (int c = 0; c < core_count; ++c) {
+    Core &core = this->cores_[c];
+    core.scheduler = config.Create(run_queues[c]);
+    core.running = nullptr;
+    core.migration = 0;
+    core.context_switch = false;
+    core.stats = CoreStats();
+  }
+}
+
+//  A destructor for the MultiCoreManager class
+//  Deletes the scheduler of every CPU
+MultiCoreManager::~MultiCoreManager() {
+  for (vector<Core>::iterator it = this->cores_.begin(); it != this->cores_.end(); ++it)
+    delete it->scheduler;
+}
+
+//  Selects where the output of the simulation goes
+//  Context switches are not printed for several CPUs, only the statistics and events
+//  First input: A pointer to the sink, which must outlive the simulation, or nullptr
+//  for the default sink which prints to console through a buffer
+//  Returns nothing
+void MultiCoreManager::set_sink(OutputSink *sink) {
+  if (sink == nullptr) {
+    if (!this->console_sink_) this->console_sink_.reset(new TextSink(cout));
+    sink = this->console_sink_.get();
+  }
+  this->sink_ = sink;
+}
+
+//  Adds an event to the event log of the sink, if it keeps one
+//  The CPU of the event is the CPU whose run queue the Process belongs to
+//  First input: The type of the event
+//  Second input: An integer representing the current time of the simulation
+//  Third input: A constant pointer to the Process the event concerns
+//  Fourth input: A value which depends on the type of the event (see EventType)
+//  Returns nothing
+void MultiCoreManager::Record(EventType type, int current_time, const Process *process,
+  int value) {
+  if (!this->record_events_) return;
+  EventRecord record = { current_time, process->id(), value,
+    static_cast<uint16_t>(this->core_of_[process->id()]), static_cast<uint8_t>(type), 0 };
+  this->sink_->Record(record);
+}
+
+//  Determines if the simulation is completed
+//  Takes no inputs
+//  Returns true if all processes in the jobs queue are in the "terminated" process state
+//  Returns false otherwise
+bool MultiCoreManager::AllTerminated() const {
+  return this->terminated_count_ == static_cast<int>(this->jobs_.size());
+}
+
+//  Determines the number of Processes in the jobs queue in the "waiting" process state
+//  Takes no inputs
+//  Returns the number of Processes in the "waiting" process state
+int MultiCoreManager::CountWaiting() const {
+  return this->waiting_.size();
+}
+
+//  Finds the Process "running" on a CPU
+//  First input: The index of the CPU
+//  Returns a pointer to the "running" Process
+//  Returns nullptr if the CPU is idle
+Process *MultiCoreManager::GetRunning(int core) const {
+  return this->cores_[core].running;
+}
+
+//  Measures how unevenly the work was spread over the CPUs
+//  Takes no inputs
+//  Returns the busy time of the busiest CPU divided by the mean busy time of all
+//  CPUs, 1 when the work is perfectly balanced and the number of CPUs when one
+//  CPU did all of it
+double MultiCoreManager::Imbalance() const {
+  long long total = 0;
+  long long most = 0;
+  for (vector<Core>::const_iterator it = this->cores_.begin(); it != this->cores_.end(); ++it) {
+    total += it->stats.busy_time;
+    most = std::max(most, it->stats.busy_time);
+  }
+  if (total == 0) return 1.0;
+  return static_cast<double>(most) * this->cores_.size() / total;
+}
+
+//  Sets a Process to the "waiting" process state and adds it to the waiting set
+//  First input: A pointer to the Process which is starting an IO burst
+//  Returns nothing
+void MultiCoreManager::AddWaiting(Process *process) {
+  process->set_state(ProcessState::kWaiting);
+  this->waiting_.Add(process);
+}
+
+//  Removes a Process from the waiting set
+//  First input: A pointer to the Process which is leaving the "waiting" process state
+//  Returns nothing
+void MultiCoreManager::RemoveWaiting(Process *process) {
+  this->waiting_.Remove(process);
+}
+
+//  Sets a Process to the "ready" process state and adds it to the run queue of its CPU
+//  First input: A pointer to the Process which is entering the ready queue
+//  Second input: An integer representing the current time of the simulation
+//  Returns nothing
+void MultiCoreManager::MakeReady(Process *process, int current_time) {
+  process->set_state(ProcessState::kReady);
+  process->set_ready_time(current_time);
+  this->cores_[this->core_of_[process->id()]].scheduler->AddProcess(process);
+}
+
+//  Sets a Process to the "terminated" process state and records its turnaround time
+//  First input: A pointer to the Process which has completed all of its bursts
+//  Second input: An integer representing the current time of the simulation
+//  Returns nothing
+void MultiCoreManager::Terminate(Process *process, int current_time) {
+  process->set_state(ProcessState::kTerminated);
+  process->set_turnaround_time(current_time - process->arrival_time());
+  ++this->terminated_count_;
+  this->wait_histogram_.Add(process->time_waiting());
+  this->turnaround_histogram_.Add(process->turnaround_time());
+  this->response_histogram_.Add(process->response_time());
+  this->Record(EventType::kTermination, current_time, process, process->time_waiting());
+}
+
+//  Moves every Process whose arrival time has come from the "new" process state into
+//  the run queue of its CPU and determines if a context switch is necessary on that CPU
+//  First input: An integer representing the current time of the simulation
+//  Returns nothing
+void MultiCoreManager::AdmitArrivals(int current_time) {
+  while (this->next_arrival_ < this->arrivals_.size() &&
+    this->arrivals_[this->next_arrival_]->arrival_time() <= current_time) {
+    Process *process = this->arrivals_[this->next_arrival_++];
+    Core &target = this->cores_[this->core_of_[process->id()]];
+    if (target.running == nullptr && target.migration == 0 && target.scheduler->QueueEmpty())
+      target.context_switch = true;
+    this->Record(EventType::kArrival, current_time, process, process->CurrentCPUTime());
+    //  initialize the Process priority to zero, so it joins the top level of the ready queue
+    process->set_priority(0);
+    this->MakeReady(process, current_time);
+  }
+}
+
+//  Has the scheduler of a CPU dispatch a new "running" Process and charges the
+//  dispatched Process for the time it spent in the ready queue
+//  First input: The index of the CPU
+//  Second input: An integer representing the current time of the simulation
+//  Returns nothing
+void MultiCoreManager::Dispatch(int core, int current_time) {
+  Core &target = this->cores_[core];
+  target.running = target.scheduler->DispatchProcess(current_time);
+  if (target.running != nullptr) {
+    target.running->set_time_waiting(target.running->time_waiting() +
+      current_time - target.running->ready_time());
+    ++target.stats.dispatches;
+    this->Record(EventType::kDispatch, current_time, target.running,
+      target.running->CurrentCPUTime());
+  }
+}
+
+//  Updates the bookkeeping of a CPU after its scheduler may have moved the "running"
+//  Process out of the "running" process state (e.g. when its time quantum expired)
+//  First input: The index of the CPU
+//  Second input: An integer representing the current time of the simulation
+//  Returns nothing
+void MultiCoreManager::SyncRunning(int core, int current_time) {
+  Process *process = this->cores_[core].running;
+  if (process == nullptr || process->state() == ProcessState::kRunning) return;
+  this->cores_[core].running = nullptr;
+  if (process->state() == ProcessState::kReady) {
+    process->set_ready_time(current_time);
+    this->Record(EventType::kQuantumExpiry, current_time, process, process->CurrentCPUTime());
+  } else if (process->state() == ProcessState::kWaiting) {
+    this->AddWaiting(process);
+    this->Record(EventType::kIOStart, current_time, process, process->CurrentIOTime());
+  } else if (process->state() == ProcessState::kTerminated) {
+    this->Terminate(process, current_time);
+  }
+}
+
+//  Lets an idle CPU with an empty run queue take a Process from the longest run queue
+//  of a busy CPU
+//  The stolen Process stays "ready" and is dispatched once the migration cost has
+//  been paid, or at once if the migration cost is 0
+//  First input: The index of the idle CPU
+//  Second input: An integer representing the current time of the simulation
+//  Returns nothing
+void MultiCoreManager::Steal(int core, int current_time) {
+  int victim = -1;
+  int longest = 0;
+  for (int c = 0; c < static_cast<int>(this->cores_.size()); ++c) {
+    if (c == core || this->cores_[c].running == nullptr) continue;
+    int length = this->cores_[c].scheduler->QueueSize();
+    if (length > longest) {
+      longest = length;
+      victim = c;
+    }
+  }
+  if (victim == -1) return;
+
+  Process *process = this->cores_[victim].scheduler->StealProcess();
+  this->core_of_[process->id()] = core;
+  this->cores_[core].scheduler->AddProcess(process);
+  ++this->cores_[core].stats.steals;
+  ++this->steal_count_;
+  if (this->config_.migration_cost > 0) this->cores_[core].migration = this->config_.migration_cost;
+  else this->Dispatch(core, current_time);
+}
+
+//  Decrements the current CPU burst of the Process "running" on a CPU and determines
+//  if a context switch is necessary on that CPU
+//  First input: The index of the CPU
+//  Second input: An integer representing the current run time of the simulation
+//  Returns nothing
+void MultiCoreManager::ProcessRunning(int core, int current_time) {
+  Core &target = this->cores_[core];
+  Process *process = target.running;
+  process->DecrementCPU();
+  if (process->CurrentCPUTime() != 0) return;
+
+  //  the burst is completed, free the CPU
+  target.context_switch = true;
+  target.running = nullptr;
+  process->PopCPU();
+  if (process->HasIO()) {
+    this->AddWaiting(process);
+    this->Record(EventType::kIOStart, current_time, process, process->CurrentIOTime());
+    process->set_priority(0);
+  } else if (process->HasCPU()) {
+    this->MakeReady(process, current_time);
+  } else {
+    this->Terminate(process, current_time);
+  }
+}
+
+//  Handles a Process in the "waiting" process state whose current IO burst has just
+//  completed and determines if a context switch is necessary on the CPU it returns to
+//  First input: A pointer to a Process object in the "waiting" process state
+//  Second input: An integer representing the current run time of the simulation
+//  Returns nothing
+void MultiCoreManager::ProcessWaiting(Process *process, int current_time) {
+  process->PopIO();
+  if (process->HasCPU()) {
+    //  an idle CPU dispatches the Process at the end of this tick
+    Core &target = this->cores_[this->core_of_[process->id()]];
+    if (target.running == nullptr && target.migration == 0 && target.scheduler->QueueEmpty())
+      target.context_switch = true;
+    this->RemoveWaiting(process);
+    this->MakeReady(process, current_time);
+  } else if (process->HasIO()) {
+    process->set_priority(0);
+    this->waiting_.Restart(process);
+  } else {
+    this->RemoveWaiting(process);
+    this->Terminate(process, current_time);
+  }
+}
+
+//  Runs the simulation on all CPUs
+//  Every tick follows the same steps as ProcessManager::SimulateScheduler on each CPU,
+//  after which idle CPUs steal work from busy ones
+//  Takes no inputs
+//  Returns nothing
+//  Outputs the events and result statistics to the sink
+void MultiCoreManager::SimulateScheduler() {
+  int current_time = 0;
+  this->record_events_ = this->sink_->records_events();
+  this->wait_histogram_.Clear();
+  this->turnaround_histogram_.Clear();
+  this->response_histogram_.Clear();
+  int core_count = static_cast<int>(this->cores_.size());
+  for (int c = 0; c < core_count; ++c) this->Dispatch(c, current_time);
+  for (int c = 0; c < core_count; ++c) {
+    if (this->cores_[c].running == nullptr && this->cores_[c].scheduler->QueueEmpty())
+      this->Steal(c, current_time);
+  }
+
+  while (!this->AllTerminated()) {
+    //  if the event engine is used skip every tick before the next event in a single step
+    if (this->config_.engine == kEventEngine) {
+      int skip = this->TimeToNextEvent(current_time) - 1;
+      if (skip > 0) {
+        this->SkipTime(skip);
+        current_time += skip;
+      }
+    }
+    ++current_time;
+
+    //  account for the tick on every CPU and finish the migrations which arrive now
+    for (vector<Core>::iterator it = this->cores_.begin(); it != this->cores_.end(); ++it) {
+      it->context_switch = false;
+      if (it->running != nullptr) {
+        ++it->stats.busy_time;
+      } else if (it->migration > 0) {
+        ++it->stats.migration_time;
+        if (--it->migration == 0) it->context_switch = true;
+      } else {
+        ++it->stats.idle_time;
+      }
+    }
+
+    //  collect the "waiting" Processes whose IO burst completes in this tick
+    this->io_completed_.clear();
+    this->waiting_.Tick(&this->io_completed_);
+    if (this->io_completed_.size() > 1)
+      sort(this->io_completed_.begin(), this->io_completed_.end(), IdLess);
+
+    //  handle the completed IO bursts and the "running" Processes in jobs queue order,
+    //  since that order decides the order in which Processes enter the run queues
+    this->running_order_.clear();
+    for (vector<Core>::iterator it = this->cores_.begin(); it != this->cores_.end(); ++it)
+      if (it->running != nullptr) this->running_order_.push_back(it->running);
+    if (this->running_order_.size() > 1)
+      sort(this->running_order_.begin(), this->running_order_.end(), IdLess);
+    vector<Process *>::iterator running = this->running_order_.begin();
+    for (vector<Process *>::iterator it = this->io_completed_.begin();
+      it != this->io_completed_.end(); ++it) {
+      while (running != this->running_order_.end() && (*running)->id() < (*it)->id()) {
+        this->ProcessRunning(this->core_of_[(*running)->id()], current_time);
+        ++running;
+      }
+      this->ProcessWaiting(*it, current_time);
+    }
+    for (; running != this->running_order_.end(); ++running)
+      this->ProcessRunning(this->core_of_[(*running)->id()], current_time);
+
+    //  admit the Processes which arrive in this tick, after those which completed a burst
+    this->AdmitArrivals(current_time);
+
+    //  preemption, time quanta and dispatch on every CPU
+    for (int c = 0; c < core_count; ++c) {
+      Core &core = this->cores_[c];
+      if (core.scheduler->Preemption(core.running)) {
+        core.context_switch = true;
+        Process *preempted = core.running;
+        this->Record(EventType::kPreemption, current_time, preempted, preempted->CurrentCPUTime());
+        preempted->set_priority(preempted->priority() - 1);
+        core.running = nullptr;
+        this->MakeReady(preempted, current_time);
+      }
+      core.scheduler->ManageTimeQuantum(core.running, core.context_switch);
+      this->SyncRunning(c, current_time);
+      if (core.context_switch && core.migration == 0) this->Dispatch(c, current_time);
+    }
+
+    //  idle CPUs with nothing to run steal from busy ones
+    for (int c = 0; c < core_count; ++c) {
+      const Core &core = this->cores_[c];
+      if (core.running == nullptr && core.migration == 0 && core.scheduler->QueueEmpty())
+        this->Steal(c, current_time);
+    }
+  }
+
+  this->CollectResult(current_time);
+  std::ostream *summary = this->sink_->summary_stream();
+  if (summary != nullptr) this->PrintStats(*summary);
+  this->sink_->Flush();
+}
+
+//  Determines the number of ticks until the next event on any CPU
+//  An event is the completion of a CPU burst, the expiry of a time quantum or another
+//  change a scheduler makes to its queues on its own, the arrival of a stolen Process,
+//  the completion of an IO burst or the arrival of a "new" Process
+//  First input: An integer representing the current time of the simulation
+//  Returns an integer representing the number of ticks until the next event
+//  Returns 1 if no event is pending
+int MultiCoreManager::TimeToNextEvent(int current_time) const {
+  int next_event = INT_MAX;
+  for (vector<Core>::const_iterator it = this->cores_.begin(); it != this->cores_.end(); ++it) {
+    if (it->running != nullptr) next_event = std::min(next_event, it->running->CurrentCPUTime());
+    else if (it->migration > 0) next_event = std::min(next_event, it->migration);
+    int quantum = it->scheduler->QuantumRemaining(it->running);
+    if (quantum > 0 && quantum < next_event) next_event = quantum;
+  }
+  next_event = std::min(next_event, this->waiting_.MinRemaining());
+  if (this->next_arrival_ < this->arrivals_.size())
+    next_event = std::min(next_event, this->arrivals_[this->next_arrival_]->arrival_time() - current_time);
+  if (next_event == INT_MAX) return 1;
+  return next_event;
+}
+
+//  Advances every CPU and "waiting" Process by several ticks at once
+//  The caller guarantees that no event occurs during the skipped ticks
+//  First input: An integer representing the number of ticks to skip
+//  Returns nothing
+void MultiCoreManager::SkipTime(int ticks) {
+  for (vector<Core>::iterator it = this->cores_.begin(); it != this->cores_.end(); ++it) {
+    if (it->running != nullptr) {
+      it->running->DecrementCPU(ticks);
+      it->stats.busy_time += ticks;
+    } else if (it->migration > 0) {
+      it->migration -= ticks;
+      it->stats.migration_time += ticks;
+    } else {
+      it->stats.idle_time += ticks;
+    }
+    it->scheduler->SkipTimeQuantum(ticks);
+  }
+  this->waiting_.Advance(ticks);
+}
+
+//  Summarizes the completed simulation into result_
+//  The idle time is summed over all CPUs and includes the time spent migrating
+//  The times of the Processes were collected into the histograms as they terminated
+//  First input: An integer representing the total time of the simulation
+//  Returns nothing
+void MultiCoreManager::CollectResult(int time) {
+  long long busy = 0;
+  for (vector<Core>::const_iterator it = this->cores_.begin(); it != this->cores_.end(); ++it)
+    busy += it->stats.busy_time;
+  double capacity = static_cast<double>(time) * this->cores_.size();
+  this->result_.process_count = static_cast<int>(this->jobs_.size());
+  this->result_.total_time = time;
+  this->result_.idle_time = static_cast<int>(capacity - busy);
+  this->result_.cpu_utilization = time > 0 ? 100.0 * busy / capacity : 0.0;
+  this->result_.wait = this->wait_histogram_.Summarize();
+  this->result_.turnaround = this->turnaround_histogram_.Summarize();
+  this->result_.response = this->response_histogram_.Summarize();
+  this->result_.average_wait = this->result_.wait.mean;
+  this->result_.average_turnaround = this->result_.turnaround.mean;
+  this->result_.average_response = this->result_.response.mean;
+
+  //  the accounting of every CPU and how evenly the work was spread over them
+  double mean = static_cast<double>(busy) / this->cores_.size();
+  double variance = 0.0;
+  this->result_.cores.clear();
+  for (vector<Core>::const_iterator it = this->cores_.begin(); it != this->cores_.end(); ++it) {
+    this->result_.cores.push_back(it->stats);
+    variance += (it->stats.busy_time - mean) * (it->stats.busy_time - mean);
+  }
+  this->result_.migrations = this->steal_count_;
+  this->result_.load_imbalance = this->Imbalance();
+  this->result_.busy_stddev = std::sqrt(variance / this->cores_.size());
+}
+
+//  Prints the statistics for the results of the simulation: the overall results,
+//  the time accounting of every CPU and the load imbalance
+//  First input: A reference to the stream to print to
+//  Returns nothing
+void MultiCoreManager::PrintStats(std::ostream &out) const {
+  const SimulationResult &result = this->result_;
+
+  out << endl << endl << "Finished" << endl << endl;
+  out << "Total Time:\t\t" << result.total_time << endl;
+  out << "CPUs:\t\t\t" << this->cores_.size() << endl;
+  out << "CPU Utilization:\t" << result.cpu_utilization << "%" << endl;
+  out << "Migrations:\t\t" << result.migrations << " (cost "
+    << this->config_.migration_cost << ")" << endl;
+  out << "Load Imbalance:\t\t" << result.load_imbalance << " (busiest / mean busy time)" << endl;
+  out << "Busy Time Std Dev:\t" << result.busy_stddev << endl << endl;
+
+  out << "CPU\tBusy\t\tIdle\t\tMigrating\tUtilization\tDispatches\tSteals" << endl;
+  for (vector<CoreStats>::size_type c = 0; c < result.cores.size(); ++c) {
+    const CoreStats &stats = result.cores[c];
+    out << c << "\t" << stats.busy_time << "\t\t" << stats.idle_time << "\t\t"
+      << stats.migration_time << "\t\t"
+      << (result.total_time > 0 ? 100.0 * stats.busy_time / result.total_time : 0.0) << "%\t\t"
+      << stats.dispatches << "\t\t" << stats.steals << endl;
+  }
+  out << endl;
+  PrintLatencyHeader(out);
+  PrintLatencyRow(out, "Wait", result.wait);
+  PrintLatencyRow(out, "Turnaround", result.turnaround);
+  PrintLatencyRow(out, "Response", result.response);
+  out << endl;
+}
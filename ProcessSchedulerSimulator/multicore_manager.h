@@ -0,0 +1,102 @@
+#ifndef MULTICORE_MANAGER_H_
+#define MULTICORE_MANAGER_H_
+
+#include "latency_histogram.h"
+#include "output_sink.h"
+#include "process.h"
+#include "process_manager.h"
+#include "scheduler.h"
+#include "scheduler_config.h"
+#include "waiting_table.h"
+
+#include <memory>
+#include <ostream>
+#include <vector>
+using std::vector;
+
+//  Simulates several CPUs which share the jobs queue
+//  Every CPU has its own run queue, a Scheduler of the configured kind, and the jobs
+//  are spread over the CPUs in turn. A Process which completes an IO burst returns to
+//  the run queue of the CPU it last ran on.
+//  A CPU which is idle with an empty run queue steals a Process from the longest run
+//  queue of a busy CPU and spends the migration cost before it may dispatch again.
+//  Processes in the "new" process state join the run queue of their CPU at their
+//  arrival times (streams of arriving Processes are only supported by ProcessManager).
+//  With one CPU the results are identical to those of a ProcessManager.
+class MultiCoreManager {
+public:
+  //  constructors
+  MultiCoreManager(const vector<Process *> &, const SchedulerConfig &);
+  ~MultiCoreManager();
+
+  //  methods
+  bool AllTerminated() const;
+  int CountWaiting() const;
+  Process *GetRunning(int) const;
+  double Imbalance() const;
+  void PrintStats(std::ostream &) const;
+  void SimulateScheduler();
+  void SkipTime(int);
+  int TimeToNextEvent(int) const;
+
+  //  getters
+  const SchedulerConfig &config() const { return this->config_; }
+  int core_count() const { return static_cast<int>(this->cores_.size()); }
+  const CoreStats &core_stats(int core) const { return this->cores_[core].stats; }
+  const vector<Process *> &jobs() const { return this->jobs_; }
+  const SimulationResult &result() const { return this->result_; }
+  Scheduler *scheduler(int core) const { return this->cores_[core].scheduler; }
+  OutputSink *sink() const { return this->sink_; }
+  long long steal_count() const { return this->steal_count_; }
+
+  //  setters
+  void set_sink(OutputSink *);
+
+private:
+  MultiCoreManager(const MultiCoreManager &);               //  not copyable, owns schedulers
+  MultiCoreManager &operator=(const MultiCoreManager &);    //  not copyable, owns schedulers
+
+  //  One CPU of the simulated machine
+  struct Core {
+    Scheduler *scheduler;   //  the run queue of the CPU (owned)
+    Process *running;       //  the Process "running" on the CPU (nullptr if none)
+    int migration;          //  ticks until a stolen Process has arrived (0 if none is moving)
+    bool context_switch;    //  whether the CPU dispatches at the end of the current tick
+    CoreStats stats;        //  the time accounting of the CPU
+  };
+
+  //  bookkeeping for process state transitions
+  void AddWaiting(Process *);
+  void AdmitArrivals(int);
+  void CollectResult(int);
+  void Dispatch(int, int);
+  void MakeReady(Process *, int);
+  void ProcessRunning(int, int);
+  void ProcessWaiting(Process *, int);
+  void Record(EventType, int, const Process *, int);
+  void RemoveWaiting(Process *);
+  void Steal(int, int);
+  void SyncRunning(int, int);
+  void Terminate(Process *, int);
+
+  vector<Process *> jobs_;          //  pointers to the Processes which are to be simulated
+  SchedulerConfig config_;          //  the kind of scheduler of every CPU and the migration cost
+  vector<Core> cores_;              //  the CPUs of the machine
+  vector<int> core_of_;             //  the CPU whose run queue each Process belongs to, by Process id
+  WaitingTable waiting_;            //  the Processes in the "waiting" state and their remaining IO times
+  vector<Process *> io_completed_;  //  the Processes which completed an IO burst in the current tick
+  vector<Process *> running_order_; //  the "running" Processes of the current tick ordered by id
+  int terminated_count_;            //  the number of Processes in the "terminated" state
+  vector<Process *> arrivals_;      //  the "new" Processes in order of arrival
+  vector<Process *>::size_type next_arrival_;   //  the position in arrivals_ of the next Process to arrive
+  long long steal_count_;           //  the number of Processes which migrated between CPUs
+  OutputSink *sink_;                //  the destination of the output of the simulation (not owned)
+  std::unique_ptr<OutputSink> console_sink_;  //  the default sink, which prints to console
+  bool record_events_;              //  whether the sink keeps an event log, cached for the simulation
+  SimulationResult result_;         //  the summary of the last completed simulation
+  LatencyHistogram wait_histogram_;         //  the waiting times of the terminated Processes
+  LatencyHistogram turnaround_histogram_;   //  the turnaround times of the terminated Processes
+  LatencyHistogram response_histogram_;     //  the response times of the terminated Processes
+};
+
+#endif  //  MULTICORE_MANAGER_H_
@@ -0,0 +1,130 @@
+#include "output_sink.h"
+
+#include <cstring>
+
+//  The magic string at the start of every binary event log file
+static const char kEventLogMagic[8] = { 'P', 'S', 'S', 'E', 'V', 'N', 'T', '\0' };
+
+//  The version of the binary event log layout written by this code
+static const uint32_t kEventLogVersion = 1;
+
+//  The byte order marker of the binary event log layout
+static const uint32_t kEventLogByteOrder = 0x01020304;
+
+//  The number of records an EventLogSink collects before writing them to the file
+static const size_t kEventLogBlock = 1 << 14;
+
+//  A constructor for the TextSink::Buffer class
+//  First input: A reference to the stream the buffer is drained to
+//  Second input: The number of characters the buffer holds
+TextSink::Buffer::Buffer(std::ostream &out, size_t size) : out_(out), data_(size > 0 ? size : 1) {
+  this->setp(this->data_.data(), this->data_.data() + this->data_.size());
+}
+
+//  Writes the buffered characters to the underlying stream and empties the buffer
+//  Takes no inputs
+//  Returns nothing
+void TextSink::Buffer::Drain() {
+  if (this->pptr() != this->pbase()) this->out_.write(this->pbase(), this->pptr() - this->pbase());
+  this->setp(this->data_.data(), this->data_.data() + this->data_.size());
+}
+
+//  Makes room for a character when the buffer is full
+//  First input: The character which did not fit, or eof
+//  Returns the character, or eof if it was eof
+TextSink::Buffer::int_type TextSink::Buffer::overflow(int_type c) {
+  this->Drain();
+  if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+  *this->pptr() = traits_type::to_char_type(c);
+  this->pbump(1);
+  return c;
+}
+
+//  Adds a run of characters to the buffer
+//  Runs which do not fit in an empty buffer are written through directly
+//  First input: A pointer to the characters
+//  Second input: The number of characters
+//  Returns the number of characters written
+std::streamsize TextSink::Buffer::xsputn(const char *s, std::streamsize n) {
+  if (n > this->epptr() - this->pptr()) {
+    this->Drain();
+    if (n > this->epptr() - this->pptr()) {
+      this->out_.write(s, n);
+      return n;
+    }
+  }
+  memcpy(this->pptr(), s, n);
+  this->pbump(static_cast<int>(n));
+  return n;
+}
+
+//  A constructor for the TextSink class
+//  First input: A reference to the stream the output is written to
+//  Second input: The size of the buffer in characters (64 KiB by default)
+TextSink::TextSink(std::ostream &out, size_t buffer_size)
+  : buffer_(out, buffer_size), stream_(&buffer_) {}
+
+//  A destructor for the TextSink class
+//  Writes out anything still buffered
+TextSink::~TextSink() {
+  this->Flush();
+}
+
+//  Writes the buffered output to the stream
+//  Takes no inputs
+//  Returns nothing
+void TextSink::Flush() {
+  this->buffer_.Drain();
+}
+
+//  A constructor for the EventLogSink class
+//  Creates the log file and writes its header
+//  First input: A constant reference to a string holding the path of the log file
+//  ok() is false if the file could not be created, in which case nothing is recorded
+EventLogSink::EventLogSink(const string &path) : file_(nullptr), event_count_(0) {
+  this->file_ = fopen(path.c_str(), "wb");
+  if (this->file_ == nullptr) return;
+  EventLogHeader header;
+  memcpy(header.magic, kEventLogMagic, sizeof(kEventLogMagic));
+  header.version = kEventLogVersion;
+  header.byte_order = kEventLogByteOrder;
+  header.record_size = sizeof(EventRecord);
+  header.reserved = 0;
+  if (fwrite(&header, sizeof(header), 1, this->file_) != 1) {
+    fclose(this->file_);
+    this->file_ = nullptr;
+    return;
+  }
+  this->pending_.reserve(kEventLogBlock);
+}
+
+//  A destructor for the EventLogSink class
+//  Writes the remaining records and closes the file
+EventLogSink::~EventLogSink() {
+  this->Flush();
+  if (this->file_ != nullptr) fclose(this->file_);
+}
+
+//  Adds an event to the log, writing a block of records once enough are collected
+//  First input: A constant reference to the record of the event
+//  Returns nothing
+void EventLogSink::Record(const EventRecord &record) {
+  if (this->file_ == nullptr) return;
+  this->pending_.push_back(record);
+  ++this->event_count_;
+  if (this->pending_.size() >= kEventLogBlock) this->Flush();
+}
+
+//  Writes the collected records to the file
+//  Takes no inputs
+//  Returns nothing
+void EventLogSink::Flush() {
+  if (this->file_ == nullptr || this->pending_.empty()) return;
+  if (fwrite(this->pending_.data(), sizeof(EventRecord), this->pending_.size(), this->file_) !=
+    this->pending_.size() || fflush(this->file_) != 0) {
+    //  stop recording once the file cannot be written, ok() reports the failure
+    fclose(this->file_);
+    this->file_ = nullptr;
+  }
+  this->pending_.clear();
+}
@@ -0,0 +1,166 @@
+#ifndef OUTPUT_SINK_H_
+#define OUTPUT_SINK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+using std::size_t;
+using std::string;
+using std::vector;
+
+//  The kinds of events recorded in an event log
+enum class EventType : uint8_t {
+  kDispatch,        //  a Process starts running, value is its remaining CPU burst
+  kPreemption,      //  a Process is preempted by a higher priority one, value is its remaining CPU burst
+  kQuantumExpiry,   //  a Process used up its time quantum, value is its remaining CPU burst
+  kIOStart,         //  a Process starts an IO burst, value is the length of the burst
+  kTermination,     //  a Process completes its last burst, value is its total waiting time
+  kArrival          //  a Process arrives and becomes "ready", value is its remaining CPU burst
+};
+
+//  One fixed size record of an event log
+struct EventRecord {
+  int32_t time;       //  the time of the simulation at which the event occurred
+  int32_t process;    //  the id of the Process, which is its position in the jobs queue
+  int32_t value;      //  a value which depends on the type of the event
+  uint16_t core;      //  the CPU on which the event occurred (0 for a single CPU)
+  uint8_t type;       //  the EventType of the event
+  uint8_t reserved;   //  always 0
+};
+
+//  The fixed size header at the start of a binary event log file, which is followed
+//  by one EventRecord per event in the order in which the events occurred
+struct EventLogHeader {
+  char magic[8];          //  identifies the file as an event log ("PSSEVNT")
+  uint32_t version;       //  version of the layout, currently 1
+  uint32_t byte_order;    //  0x01020304 as written by the machine which created the file
+  uint32_t record_size;   //  sizeof(EventRecord)
+  uint32_t reserved;      //  always 0
+};
+
+//  An interface to be implemented by every destination of simulation output
+//  Text is only formatted when the sink provides a stream for it, so a sink which
+//  wants neither text nor events costs nothing during a simulation
+class OutputSink {
+public:
+  //  Sinks are destroyed through pointers to this interface
+  virtual ~OutputSink() {}
+
+  //  Provides the stream the state of the simulation is printed to on every context switch
+  //  Takes no inputs
+  //  Returns a pointer to the stream, or nullptr if context switches are not printed
+  virtual std::ostream *context_stream() = 0;
+
+  //  Provides the stream the statistics of a completed simulation are printed to
+  //  Takes no inputs
+  //  Returns a pointer to the stream, or nullptr if the statistics are not printed
+  virtual std::ostream *summary_stream() = 0;
+
+  //  Determines whether Record should be called at all
+  //  Takes no inputs
+  //  Returns true if the sink keeps an event log
+  virtual bool records_events() const = 0;
+
+  //  Adds an event to the event log
+  //  First input: A constant reference to the record of the event
+  //  Returns nothing
+  virtual void Record(const EventRecord &) = 0;
+
+  //  Writes out anything the sink has buffered, called at the end of every simulation
+  //  Takes no inputs
+  //  Returns nothing
+  virtual void Flush() = 0;
+};
+
+//  A sink which discards the context switches and events and only prints the
+//  statistics, to the given stream or nowhere at all if the stream is null
+class SummarySink : public OutputSink {
+public:
+  //  constructors
+  SummarySink() : out_(nullptr) {}
+  explicit SummarySink(std::ostream *out) : out_(out) {}
+
+  //  methods
+  std::ostream *context_stream() { return nullptr; }
+  std::ostream *summary_stream() { return this->out_; }
+  bool records_events() const { return false; }
+  void Record(const EventRecord &) {}
+  void Flush() { if (this->out_ != nullptr) this->out_->flush(); }
+
+private:
+  std::ostream *out_;   //  the stream the statistics are printed to (nullptr for none)
+};
+
+//  A sink which prints the human readable context switches and statistics to a
+//  stream through a large buffer
+//  Flushes requested while printing (e.g. by endl) are ignored, the buffer is only
+//  written when it is full, on Flush and when the sink is destroyed
+class TextSink : public OutputSink {
+public:
+  //  constructors
+  explicit TextSink(std::ostream &, size_t = 1 << 16);
+  ~TextSink();
+
+  //  methods
+  std::ostream *context_stream() { return &this->stream_; }
+  std::ostream *summary_stream() { return &this->stream_; }
+  bool records_events() const { return false; }
+  void Record(const EventRecord &) {}
+  void Flush();
+
+private:
+  TextSink(const TextSink &);               //  not copyable, the stream refers to the buffer
+  TextSink &operator=(const TextSink &);    //  not copyable, the stream refers to the buffer
+
+  //  A stream buffer which collects characters until it is drained
+  class Buffer : public std::streambuf {
+  public:
+    Buffer(std::ostream &, size_t);
+    void Drain();
+  protected:
+    int_type overflow(int_type);
+    std::streamsize xsputn(const char *, std::streamsize);
+    int sync() { return 0; }    //  flushes are deferred to Drain
+  private:
+    std::ostream &out_;     //  the stream the buffer is drained to
+    vector<char> data_;     //  storage for the buffered characters
+  };
+
+  Buffer buffer_;         //  the buffer behind stream_
+  std::ostream stream_;   //  the stream the simulation prints to
+};
+
+//  A sink which writes a compact binary log with one EventRecord per event to a file
+//  and discards the human readable output
+//  Records are collected in memory and written in large blocks
+class EventLogSink : public OutputSink {
+public:
+  //  constructors
+  explicit EventLogSink(const string &);
+  ~EventLogSink();
+
+  //  methods
+  std::ostream *context_stream() { return nullptr; }
+  std::ostream *summary_stream() { return nullptr; }
+  bool records_events() const { return this->file_ != nullptr; }
+  void Record(const EventRecord &);
+  void Flush();
+
+  //  getters
+  uint64_t event_count() const { return this->event_count_; }
+  bool ok() const { return this->file_ != nullptr; }
+
+private:
+  EventLogSink(const EventLogSink &);               //  not copyable, owns a file
+  EventLogSink &operator=(const EventLogSink &);    //  not copyable, owns a file
+
+  FILE *file_;                    //  the log file (nullptr if it could not be created)
+  vector<EventRecord> pending_;   //  records not yet written to the file
+  uint64_t event_count_;          //  the number of records added to the log
+};
+
+#endif  //  OUTPUT_SINK_H_
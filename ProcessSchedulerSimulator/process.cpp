@@ -7,9 +7,14 @@ using std::vector;
 
 //  A Default Constructor for the Process class
 //  Takes no inputs
-//  Does not set values for CPU bursts, IO bursts, process name, or process state
+//  Does not set values for CPU bursts or IO bursts, the name is empty
 //  Sets other fields to default values
-Process::Process() {
+Process::Process() : name_(""), name_length_(0) {
+  this->Rewind();
+  this->id_ = 0;
+  this->arrival_time_ = 0;
+  this->ready_time_ = 0;
+  this->state_ = ProcessState::kReady;
   this->response_flag_ = false;
   this->response_time_ = 0;
   this->time_waiting_ = 0;
@@ -17,15 +22,21 @@ Process::Process() {
   this->priority_ = 1;
 }
 
-//  A Constructor for the Process class
-//  First input: A constant reference to a vector of ints representing the CPU bursts in order to be executed
-//  Second input: A constant reference to a vector of ints representing the IO bursts in order to be executed
-//  Third input: A constant reference to a string representing the name of the process
-//  Fourth input: A constant reference to a string representing the state of the process
+//  A Constructor for the Process class which does not copy its bursts or its name
+//  First input: A constant reference to a BurstList viewing the CPU bursts in order to be executed
+//  Second input: A constant reference to a BurstList viewing the IO bursts in order to be executed
+//  Third input: A pointer to the characters of the name of the process
+//  Fourth input: An integer representing the number of characters in the name
+//  Fifth input: A ProcessState representing the initial state of the process
+//  The viewed bursts and name must outlive the Process
 //  Sets other fields to default values
-Process::Process(const vector<int> &cpus,
-  const vector<int> &io, const string &name, const string &state)
-  : cpus_(cpus), ios_(io), name_(name), state_(state) {
+Process::Process(const BurstList &cpus, const BurstList &io,
+  const char *name, int name_length, ProcessState state)
+  : cpus_(cpus), ios_(io), name_(name), name_length_(name_length), state_(state) {
+  this->Rewind();
+  this->id_ = 0;
+  this->arrival_time_ = 0;
+  this->ready_time_ = 0;
   this->response_flag_ = false;
   this->response_time_ = 0;
   this->time_waiting_ = 0;
@@ -36,65 +47,91 @@ Process::Process(const vector<int> &cpus,
 //  A method to return the remaining CPU burst time for the current CPU burst
 //  Takes no inputs
 //  Should only be called on processes in the "ready" or "running" process state
-//  Returns the value of the first entry in the CPU bursts vector,
-//  which represents the current remaining burst time
+//  Returns the time remaining in the CPU burst under the CPU cursor
 int Process::CurrentCPUTime() const {
-  return this->cpus_.front();
+  return this->cpu_remaining_;
 }
 
-//  A method to return the remaining IO burst time for the current IO burst
+//  A method to return the length of the current IO burst
+//  While the Process is waiting, the time remaining in the burst is kept by the WaitingTable
 //  Takes no inputs
-//  Should only be called on processes in the "waiting" process state
-//  Returns the value of the first entry in the IO bursts vector,
-//  which represents the current remaining burst time 
+//  Returns the length of the IO burst under the IO cursor
+//  Returns 0 if every IO burst has been executed
 int Process::CurrentIOTime() const {
-  return this->ios_.front();
+  return this->HasIO() ? this->ios_[this->io_cursor_] : 0;
 }
 
-//  A method to decrement the current CPU burst (the burst at the front of the CPU burst vector)
+//  A method to decrement the current CPU burst (the burst under the CPU cursor)
 //  Takes no inputs
 //  Should only be called on processes in the "running" process state
 //  Returns nothing
 void Process::DecrementCPU() {
-  --this->cpus_.front();
+  --this->cpu_remaining_;
 }
 
-//  A method to decrement the current IO burst (the burst at the front of the IO burst vector)
-//  Takes no inputs
-//  Should only be called on processes in the "waiting" process state
+//  A method to decrement the current CPU burst by several time units at once
+//  First input: An integer representing the number of time units to remove from the burst
+//  Should only be called on processes in the "running" process state
 //  Returns nothing
-void Process::DecrementIO() {
-  --this->ios_.front();
+void Process::DecrementCPU(int time) {
+  this->cpu_remaining_ -= time;
 }
 
 //  A method to determine if the process has more CPU bursts to be executed
 //  Takes no inputs
-//  Returns true if the CPU burst vector is not empty
-//  Returns false if the CPU burst vector is empty
+//  Returns true if the CPU cursor has not passed the last CPU burst
+//  Returns false if every CPU burst has been executed
 bool Process::HasCPU() const {
-  return !this->cpus_.empty();
+  return this->cpu_cursor_ < this->cpus_.size();
 }
 
 //  A method to determine if the process has more IO bursts to be executed
 //  Takes no inputs
-//  Retruns true if the IO burst vector is not empty
-//  Returns true if the IO burst vector is empty
+//  Returns true if the IO cursor has not passed the last IO burst
+//  Returns false if every IO burst has been executed
 bool Process::HasIO() const {
-  return !this->ios_.empty();
+  return this->io_cursor_ < this->ios_.size();
 }
 
-//  A method to remove the current CPU burst of a Process 
-//  (erases the burst at the front of the CPU burst vector)
+//  A method to remove the current CPU burst of a Process
+//  (advances the CPU cursor to the next burst, the burst list is left untouched)
 //  Takes no inputs
 //  Returns nothing
 void Process::PopCPU() {
-  this->cpus_.erase(this->cpus_.begin());
+  ++this->cpu_cursor_;
+  this->cpu_remaining_ = this->HasCPU() ? this->cpus_[this->cpu_cursor_] : 0;
 }
 
 //  A method to remove the current IO burst of a Process
-//  (erases the burst at the front of the IO burst vector)
+//  (advances the IO cursor to the next burst, the burst list is left untouched)
 //  Takes no inputs
 //  Returns nothing
 void Process::PopIO() {
-  this->ios_.erase(this->ios_.begin());
+  ++this->io_cursor_;
+}
+
+//  A method to return the Process to the state it was created in, in the "ready"
+//  process state or, if it arrives after time 0, the "new" process state, so that it
+//  may be simulated again without being recreated
+//  Takes no inputs
+//  Returns nothing
+void Process::Reset() {
+  this->Rewind();
+  this->ready_time_ = this->arrival_time_;
+  this->state_ = this->arrival_time_ > 0 ? ProcessState::kNew : ProcessState::kReady;
+  this->response_flag_ = false;
+  this->response_time_ = 0;
+  this->time_waiting_ = 0;
+  this->turnaround_time_ = 0;
+  this->priority_ = 1;
+}
+
+//  A method to move the CPU and IO cursors back to the first burst so that the
+//  bursts of the Process may be executed again
+//  Takes no inputs
+//  Returns nothing
+void Process::Rewind() {
+  this->cpu_cursor_ = 0;
+  this->io_cursor_ = 0;
+  this->cpu_remaining_ = this->cpus_.empty() ? 0 : this->cpus_[0];
 }
\ No newline at end of file
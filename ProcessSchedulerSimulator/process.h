@@ -6,53 +6,99 @@
 using std::string;
 using std::vector;
 
+//  The process states a Process moves through during a simulation
+//  A Process is "new" until its arrival time, when it enters the ready queue
+enum class ProcessState : unsigned char { kNew, kReady, kRunning, kWaiting, kTerminated };
+
+//  A read only view of a list of burst times stored elsewhere (e.g. in a Workload),
+//  which must outlive it
+class BurstList {
+public:
+  //  constructors
+  BurstList() : data_(nullptr), count_(0) {}
+  BurstList(const int *data, int count) : data_(data), count_(count) {}
+
+  //  methods
+  int operator[](int i) const { return this->data_[i]; }
+  const int *data() const { return this->data_; }
+  bool empty() const { return this->count_ == 0; }
+  int size() const { return this->count_; }
+
+private:
+  const int *data_;     //  the first burst
+  int count_;           //  the number of bursts
+};
+
+//  The state of one process during one simulation
+//  The bursts and the name of a Process are views into an immutable store, normally
+//  the Workload it was created from, which is never modified while simulating. A
+//  Process only holds what a simulation changes: its cursors, the time remaining in
+//  its current bursts and its statistics. Any number of simulations, e.g. of different
+//  schedulers on different threads, can therefore run on one copy of a workload, each
+//  with its own Process objects.
 class Process {
 public:
   //  constructors
   Process();
-  Process(const vector<int> &, const vector<int> &,
-    const string &, const string &);
+  Process(const BurstList &, const BurstList &,
+    const char *, int, ProcessState);
 
   //  methods
   int CurrentCPUTime() const;
   int CurrentIOTime() const;
   void DecrementCPU();
-  void DecrementIO();
+  void DecrementCPU(int);
   bool HasCPU() const;
   bool HasIO() const;
   void PopCPU();
   void PopIO();
+  void Reset();
+  void Rewind();
 
   //  getters
-  const vector<int> &cpus() const { return this->cpus_; }
-  const vector<int> &ios() const { return this->ios_; }
-  const string &name() const { return this->name_; }
+  int arrival_time() const { return this->arrival_time_; }
+  int cpu_cursor() const { return this->cpu_cursor_; }
+  const BurstList &cpus() const { return this->cpus_; }
+  int id() const { return this->id_; }
+  int io_cursor() const { return this->io_cursor_; }
+  const BurstList &ios() const { return this->ios_; }
+  string name() const { return string(this->name_, this->name_length_); }
   int priority() const { return this->priority_; }
+  int ready_time() const { return this->ready_time_; }
   bool response_flag() const { return this->response_flag_; }
   int response_time() const { return this->response_time_; }
-  const string &state() const { return this->state_; }
+  ProcessState state() const { return this->state_; }
   int turnaround_time() const { return this->turnaround_time_; }
   int time_waiting() const { return this->time_waiting_; }
 
   //  setters
-  void set_cpus(const vector<int> &cpus) { this->cpus_ = cpus; }
-  void set_ios(const vector<int> &ios) { this->ios_ = ios; }
-  void set_name(const string &name) { this->name_ = name; }
+  void set_arrival_time(int time) { this->arrival_time_ = time > 0 ? time : 0; }
+  void set_cpus(const BurstList &cpus) { this->cpus_ = cpus; this->Rewind(); }
+  void set_id(int id) { this->id_ = id; }
+  void set_ios(const BurstList &ios) { this->ios_ = ios; this->Rewind(); }
   void set_priority(int priority) { this->priority_ = priority; }
+  void set_ready_time(int time) { this->ready_time_ = time; }
   void set_response_flag(bool flag) { this->response_flag_ = flag; }
   void set_response_time(int time) { this->response_time_ = time; }
-  void set_state(const string &state) { this->state_ = state; }
+  void set_state(ProcessState state) { this->state_ = state; }
   void set_turnaround_time(int time) { this->turnaround_time_ = time; }
   void set_time_waiting(int time) { this->time_waiting_ = time; }
 
 private:
-  vector<int> cpus_;    //  vector of ints specifying the CPU bursts
-  vector<int> ios_;       //  vector of ints specifying the IO bursts
-  string name_;           //  string specifying the name of the process
+  BurstList cpus_;        //  view of the CPU bursts (never modified while simulating)
+  BurstList ios_;         //  view of the IO bursts (never modified while simulating)
+  int cpu_cursor_;        //  integer specifying the index of the current CPU burst
+  int io_cursor_;         //  integer specifying the index of the current IO burst
+  int cpu_remaining_;     //  integer to keep track of the time remaining in the current CPU burst
+  const char *name_;      //  view of the characters of the name of the process (not terminated)
+  int name_length_;       //  integer specifying the number of characters in the name
+  int id_;                //  integer specifying the position of the process in the jobs queue
+  int arrival_time_;      //  integer specifying when the process enters the ready queue
   int priority_;          //  integer to keep track of the current priority of the process
+  int ready_time_;        //  integer to keep track of when the process last entered the ready state
   bool response_flag_;    //  flag to check if response time has been set
   int response_time_;     //  integer to keep track of the first time the process is in running state
-  string state_;          //  string for the current state of the process
+  ProcessState state_;    //  the current state of the process
   int turnaround_time_;   //  integer to keep track of when process finishes all CPU and IO bursts
   int time_waiting_;      //  integer to keep track of time spent in ready queue
 };
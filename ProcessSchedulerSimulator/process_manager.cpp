@@ -1,32 +1,106 @@
 #include "fcfs_scheduler.h"
+#include "mlfq_scheduler.h"
 #include "process_manager.h"
+#include "sjf_scheduler.h"
+#include "srtf_scheduler.h"
 
+#include <algorithm>
+#include <climits>
 #include <iostream>
 using std::cout;
 using std::endl;
+using std::sort;
 
 //  A Constructor for the ProcessManager class
+//  Uses the tick engine to advance the clock of the simulation
 //  First input: A constant reference to a vector of Process pointers to each 
 //  of the Processes to be simulated
 //  Second input: A pointer to a scheduler object which is the scheduler used 
 //  during the simulation
-ProcessManager::ProcessManager(const vector<Process*> &jobs, Scheduler *scheduler)
-  : jobs_(jobs), scheduler_(scheduler) { }
+template <typename SchedulerT>
+BasicProcessManager<SchedulerT>::BasicProcessManager(const vector<Process*> &jobs,
+  SchedulerT *scheduler)
+  : scheduler_(scheduler), jobs_(jobs), engine_mode_(kTickEngine), sink_(nullptr),
+    record_events_(false), result_(), stream_(nullptr) {
+  this->set_sink(nullptr);
+  this->TrackJobs();
+}
+
+//  A Constructor for the ProcessManager class
+//  First input: A constant reference to a vector of Process pointers to each 
+//  of the Processes to be simulated
+//  Second input: A pointer to a scheduler object which is the scheduler used 
+//  during the simulation
+//  Third input: An EngineMode selecting whether the clock advances one tick at a
+//  time or jumps directly to the next event
+template <typename SchedulerT>
+BasicProcessManager<SchedulerT>::BasicProcessManager(const vector<Process*> &jobs,
+  SchedulerT *scheduler, EngineMode mode)
+  : scheduler_(scheduler), jobs_(jobs), engine_mode_(mode), sink_(nullptr),
+    record_events_(false), result_(), stream_(nullptr) {
+  this->set_sink(nullptr);
+  this->TrackJobs();
+}
+
+//  Selects where the output of the simulation goes
+//  First input: A pointer to the sink, which must outlive the simulation, or nullptr
+//  for the default sink which prints everything to console through a buffer
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::set_sink(OutputSink *sink) {
+  if (sink == nullptr) {
+    if (!this->console_sink_) this->console_sink_.reset(new TextSink(cout));
+    sink = this->console_sink_.get();
+  }
+  this->sink_ = sink;
+}
+
+//  Rewinds a simulation to its initial state so that it can be run again
+//  Every Process in the jobs queue returns to the "ready" process state (or to the "new"
+//  process state until its arrival time) with its first bursts, and the scheduler queues
+//  the "ready" ones again as when it was constructed. The storage
+//  of the Processes, the queues and the waiting set is kept, so a workload can be
+//  simulated many times without reallocating.
+//  NOTE: the Processes of a stream are gone once they terminate, so a simulation driven
+//  by a stream cannot be rewound
+//  Takes no inputs
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::Reset() {
+  for (vector<Process *>::iterator it = this->jobs_.begin(); it != this->jobs_.end(); ++it)
+    (*it)->Reset();
+  this->scheduler_->Reset(this->jobs_);
+  this->result_ = SimulationResult();
+  this->TrackJobs();
+}
+
+//  Adds an event to the event log of the sink, if it keeps one
+//  First input: The type of the event
+//  Second input: An integer representing the current time of the simulation
+//  Third input: A constant pointer to the Process the event concerns
+//  Fourth input: A value which depends on the type of the event (see EventType)
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::Record(EventType type, int current_time,
+  const Process *process, int value) {
+  if (!this->record_events_) return;
+  EventRecord record = { current_time, process->id(), value, 0, static_cast<uint8_t>(type), 0 };
+  this->sink_->Record(record);
+}
 
 //  Determines if the simulation is completed by check if all Processes in the 
 //  jobs queue are in the "terminated" process state
+//  With a stream, every Process of the stream must also have arrived and terminated
 //  Takes no inputs
 //  Returns true if all processes in the jobs queue are in the "terminated" 
 //  process state
 //  Returns false if any of the processes in the jobs queue are not in the 
 //  "terminated" process state
-bool ProcessManager::AllTerminated() const {
-  for (vector<Process *>::const_iterator it = this->jobs_.begin();
-    it != this->jobs_.end(); ++it) {
-    if ((*it)->state() != "terminated")
-      return false;
-  }
-  return true;
+template <typename SchedulerT>
+bool BasicProcessManager<SchedulerT>::AllTerminated() const {
+  if (this->stream_ != nullptr)
+    return this->terminated_count_ == this->admitted_count_ && this->stream_->NextArrival() == INT_MAX;
+  return this->terminated_count_ == static_cast<int>(this->jobs_.size());
 }
 
 //  Determines if there are any Processes in the jobs queue in the "terminated"
@@ -36,198 +110,483 @@ bool ProcessManager::AllTerminated() const {
 //  state
 //  Returns false if the jobs queue does not contain a Process in the "terminated"
 //  process state
-bool ProcessManager::HasTerminated() const {
-  for (vector<Process *>::const_iterator it = this->jobs_.begin();
-    it != this->jobs_.end(); ++it) {
-    if ((*it)->state() == "terminated")
-      return true;
-  }
-  return false;
+template <typename SchedulerT>
+bool BasicProcessManager<SchedulerT>::HasTerminated() const {
+  return this->terminated_count_ > 0;
 }
 
 //  Determines the number of Processes in the jobs queue in the "waiting" process state
 //  Takes no inputs
 //  Returns an integer representing the number of Process objects in the jobs queue which
 //  are in the "waiting" process state
-int ProcessManager::CountWaiting() const {
-  int count = 0;
-  for (vector<Process *>::const_iterator it = this->jobs_.begin();
-    it != this->jobs_.end(); ++it) {
-    if ((*it)->state() == "waiting") ++count;
-  }
-  return count;
+template <typename SchedulerT>
+int BasicProcessManager<SchedulerT>::CountWaiting() const {
+  return this->waiting_.size();
 }
 
 //  Finds the Process in the jobs queue in the "running" process state
 //  Takes no inputs
 //  Returns a pointer to the Process object in the jobs queue which is in the "running"
 //  process state
-Process *ProcessManager::GetRunning() const {
-  for (vector<Process *>::const_iterator it = this->jobs_.begin();
-    it != this->jobs_.end(); ++it) {
-    if ((*it)->state() == "running")
-      return *it;
+//  Returns nullptr if the CPU is idle
+template <typename SchedulerT>
+Process *BasicProcessManager<SchedulerT>::GetRunning() const {
+  return this->running_;
+}
+
+//  Assigns each Process its position in the jobs queue as its id and rebuilds the
+//  running, waiting and terminated bookkeeping from the current Process states
+//  The Processes in the "new" process state are ordered by their arrival times, those
+//  with equal arrival times keep their order in the jobs queue
+//  Takes no inputs
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::TrackJobs() {
+  this->running_ = nullptr;
+  this->waiting_.Clear(static_cast<int>(this->jobs_.size()));
+  this->terminated_count_ = 0;
+  this->arrivals_.clear();
+  this->next_arrival_ = 0;
+  this->free_ids_.clear();
+  this->admitted_count_ = 0;
+  for (vector<Process *>::size_type i = 0; i < this->jobs_.size(); ++i) {
+    Process *process = this->jobs_[i];
+    process->set_id(static_cast<int>(i));
+    if (process->state() == ProcessState::kRunning) this->running_ = process;
+    else if (process->state() == ProcessState::kWaiting) this->AddWaiting(process);
+    else if (process->state() == ProcessState::kTerminated) ++this->terminated_count_;
+    else if (process->state() == ProcessState::kNew) this->arrivals_.push_back(process);
+  }
+  std::stable_sort(this->arrivals_.begin(), this->arrivals_.end(),
+    [](const Process *lhs, const Process *rhs) { return lhs->arrival_time() < rhs->arrival_time(); });
+}
+
+//  Moves every Process whose arrival time has come from the "new" process state into
+//  the ready queue, first those of the jobs queue and then those of the stream
+//  A streamed Process is added to the jobs queue, taking the id of a terminated one
+//  if there is any
+//  First input: An integer representing the current time of the simulation
+//  Second input: A reference to a boolean value representing the context switch flag
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::AdmitArrivals(int current_time, bool &context_switch) {
+  while (this->next_arrival_ < this->arrivals_.size() &&
+    this->arrivals_[this->next_arrival_]->arrival_time() <= current_time) {
+    this->Arrive(this->arrivals_[this->next_arrival_], current_time, context_switch);
+    ++this->next_arrival_;
+  }
+  if (this->stream_ == nullptr) return;
+  while (this->stream_->NextArrival() <= current_time) {
+    Process *process = this->stream_->Admit();
+    if (this->free_ids_.empty()) {
+      process->set_id(static_cast<int>(this->jobs_.size()));
+      this->jobs_.push_back(process);
+      this->waiting_.Reserve(static_cast<int>(this->jobs_.size()));
+    } else {
+      process->set_id(this->free_ids_.back());
+      this->free_ids_.pop_back();
+      this->jobs_[process->id()] = process;
+    }
+    ++this->admitted_count_;
+    this->Arrive(process, current_time, context_switch);
+  }
+}
+
+//  Adds an arriving Process to the ready queue and determines if a context switch is
+//  necessary
+//  First input: A pointer to the Process in the "new" process state
+//  Second input: An integer representing the current time of the simulation
+//  Third input: A reference to a boolean value representing the context switch flag
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::Arrive(Process *process, int current_time,
+  bool &context_switch) {
+  //  if the CPU is idle the arriving Process will become the new "running" Process
+  if (this->running_ == nullptr && this->scheduler_->QueueEmpty()) context_switch = true;
+  this->Record(EventType::kArrival, current_time, process, process->CurrentCPUTime());
+  //  initialize the Process priority to zero, so it joins the top level of the ready queue
+  process->set_priority(0);
+  this->MakeReady(process, current_time);
+}
+
+//  Sets a Process to the "waiting" process state and adds it to the waiting set
+//  First input: A pointer to the Process which is starting an IO burst
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::AddWaiting(Process *process) {
+  process->set_state(ProcessState::kWaiting);
+  this->waiting_.Add(process);
+}
+
+//  Removes a Process from the waiting set
+//  First input: A pointer to the Process which is leaving the "waiting" process state
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::RemoveWaiting(Process *process) {
+  this->waiting_.Remove(process);
+}
+
+//  Sets a Process to the "ready" process state and adds it to the ready queue
+//  First input: A pointer to the Process which is entering the ready queue
+//  Second input: An integer representing the current time of the simulation
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::MakeReady(Process *process, int current_time) {
+  process->set_state(ProcessState::kReady);
+  process->set_ready_time(current_time);
+  CountedCall(&this->counters_, SchedulerCall::kAddProcess,
+    [&] { this->scheduler_->AddProcess(process); });
+}
+
+//  Sets a Process to the "terminated" process state and records its turnaround time
+//  A streamed Process is removed from the jobs queue and given back to the stream
+//  First input: A pointer to the Process which has completed all of its bursts
+//  Second input: An integer representing the current time of the simulation
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::Terminate(Process *process, int current_time) {
+  process->set_state(ProcessState::kTerminated);
+  process->set_turnaround_time(current_time - process->arrival_time());
+  ++this->terminated_count_;
+  this->wait_histogram_.Add(process->time_waiting());
+  this->turnaround_histogram_.Add(process->turnaround_time());
+  this->response_histogram_.Add(process->response_time());
+  this->Record(EventType::kTermination, current_time, process, process->time_waiting());
+  if (this->stream_ != nullptr) {
+    this->jobs_[process->id()] = nullptr;
+    this->free_ids_.push_back(process->id());
+    this->stream_->Retire(process);
+  }
+}
+
+//  Has the scheduler dispatch a new "running" Process and charges the dispatched
+//  Process for the time it spent in the ready queue
+//  First input: An integer representing the current time of the simulation
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::Dispatch(int current_time) {
+  this->running_ = CountedCall(&this->counters_, SchedulerCall::kDispatchProcess,
+    [&] { return this->scheduler_->DispatchProcess(current_time); });
+  COUNTERS_ONLY(++this->counters_.context_switches;)
+  if (this->running_ != nullptr) {
+    COUNTERS_ONLY(this->counters_.CountDispatch(this->scheduler_->DispatchLevel());)
+    this->running_->set_time_waiting(this->running_->time_waiting() +
+      current_time - this->running_->ready_time());
+    this->Record(EventType::kDispatch, current_time, this->running_,
+      this->running_->CurrentCPUTime());
+  }
+}
+
+//  Updates the bookkeeping after the scheduler may have moved the "running" Process
+//  out of the "running" process state (e.g. when its time quantum expired)
+//  First input: An integer representing the current time of the simulation
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::SyncRunning(int current_time) {
+  Process *process = this->running_;
+  if (process == nullptr || process->state() == ProcessState::kRunning) return;
+  this->running_ = nullptr;
+  if (process->state() == ProcessState::kReady) {
+    process->set_ready_time(current_time);
+    COUNTERS_ONLY(++this->counters_.quantum_expirations;)
+    this->Record(EventType::kQuantumExpiry, current_time, process, process->CurrentCPUTime());
+  } else if (process->state() == ProcessState::kWaiting) {
+    this->AddWaiting(process);
+    this->Record(EventType::kIOStart, current_time, process, process->CurrentIOTime());
+  } else if (process->state() == ProcessState::kTerminated) {
+    this->Terminate(process, current_time);
   }
-  return nullptr;
 }
 
 //  Runs the actual simulation
 //  Takes no inputs
 //  Returns nothing
-//  Outputs all context switches and result statistics to console
-void ProcessManager::SimulateScheduler() {
+//  Outputs all context switches, events and result statistics to the sink
+//  NOTE: the summary of the simulation is available from result() afterwards
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::SimulateScheduler() {
   int current_time = 0;                               //  track current time of simulation
   int idle_time = 0;                                  //  track time CPU is idle
-
-  //  get the first Process from the scheduler
-  this->scheduler_->DispatchProcess(current_time);
+  std::ostream *context = this->sink_->context_stream();
+  this->record_events_ = this->sink_->records_events();
+  this->wait_histogram_.Clear();
+  this->turnaround_histogram_.Clear();
+  this->response_histogram_.Clear();
+  this->counters_.Clear();
+  COUNTERS_ONLY(int ready_length = 0;)    //  the length of the ready queue at the end of the last tick
+
+  //  admit the Processes which arrive at time 0 and get the first Process from the scheduler
+  bool arrived = false;
+  this->AdmitArrivals(current_time, arrived);
+  this->Dispatch(current_time);
   
   //  print the first context switch
-  this->PrintContext(current_time);
+  if (context != nullptr) this->PrintContext(*context, current_time);
 
   //  while any of the Process' are not in the "terminated" process state
   while (!this->AllTerminated()) {
     bool context_switch = false;    //  create a context switch flag for the current iteration
 
+    //  if the event engine is used skip every tick before the next event in a single step
+    //  NOTE: the tick in which the next event occurs is still simulated below, so both
+    //  engines produce identical results
+    if (this->engine_mode_ == kEventEngine) {
+      int skip = this->TimeToNextEvent(current_time) - 1;
+      if (skip > 0) {
+        if (this->running_ == nullptr) idle_time += skip;
+        this->SkipTime(skip);
+        current_time += skip;
+        COUNTERS_ONLY(this->counters_.SampleReadyLength(ready_length, skip);)
+      }
+    }
+
     //  increment the current time of simulation
     ++current_time;
 
     //  if there is currently no Process in the "running" process state then increment idle time
-    if (this->GetRunning() == nullptr) ++idle_time;
-
-    //  for each Process in the jobs queue
-    for (vector<Process *>::iterator it = this->jobs_.begin();
-      it != this->jobs_.end(); ++it) {
-      //  if the Process is in the "running" process state call ProcessRunning
-      if ((*it)->state() == "running") {
-        this->ProcessRunning(*it, current_time, context_switch);
-      } 
-      
-      //  else if the Process is in the "waiting" process state call ProcessWaiting
-      else if ((*it)->state() == "waiting") {
-        this->ProcessWaiting(*it, current_time, context_switch);
-      } 
-      
-      //  else if the Process is in the "ready" process state increment waiting time for the Process
-      else if ((*it)->state() == "ready") {
-        (*it)->set_time_waiting((*it)->time_waiting() + 1);
+    if (this->running_ == nullptr) ++idle_time;
+
+    //  collect the Processes in the "waiting" process state whose IO burst completes
+    //  in this tick, the others are not visited
+    this->io_completed_.clear();
+    this->waiting_.Tick(&this->io_completed_);
+
+    //  handle the completed IO bursts and the "running" Process in jobs queue order,
+    //  since that order decides the order in which Processes enter the ready queue
+    //  NOTE: Processes which are "ready" accumulate waiting time when they are dispatched
+    if (this->io_completed_.size() > 1) {
+      sort(this->io_completed_.begin(), this->io_completed_.end(),
+        [](const Process *lhs, const Process *rhs) { return lhs->id() < rhs->id(); });
+    }
+    Process *running = this->running_;
+    for (vector<Process *>::iterator it = this->io_completed_.begin();
+      it != this->io_completed_.end(); ++it) {
+      if (running != nullptr && running->id() < (*it)->id()) {
+        this->ProcessRunning(running, current_time, context_switch);
+        running = nullptr;
       }
+      this->ProcessWaiting(*it, current_time, context_switch);
     }
+    if (running != nullptr) this->ProcessRunning(running, current_time, context_switch);
+
+    //  admit the Processes which arrive in this tick, after those which completed a burst
+    this->AdmitArrivals(current_time, context_switch);
 
     //  Check to see if preemption is required
-    //  NOTE: Only returns true for our MLFQScheduler class
-    if (this->scheduler_->Preemption(this->GetRunning())) {
+    //  NOTE: Only returns true for our MLFQScheduler and SRTFScheduler classes, and is left
+    //  out at compile time for scheduler classes which are not preemptive
+    if (SchedulerTraits<SchedulerT>::preemptive && CountedCall(&this->counters_,
+      SchedulerCall::kPreemption, [&] { return this->scheduler_->Preemption(this->running_); })) {
       //  set context switch flag true
       context_switch = true;
       
       //  since preempted Process' which are running return to the ready queue
       //  from which they came we must first decrement that Process' priority
       //  as it will be incremented when we call AddProcess
-      this->GetRunning()->set_priority(this->GetRunning()->priority() - 1);
+      Process *preempted = this->running_;
+      COUNTERS_ONLY(++this->counters_.preemptions;)
+      this->Record(EventType::kPreemption, current_time, preempted, preempted->CurrentCPUTime());
+      preempted->set_priority(preempted->priority() - 1);
 
       //  add the preempted Process back to the ready queue and set its process state to "ready"
-      this->scheduler_->AddProcess(this->GetRunning());
-      this->GetRunning()->set_state("ready");
+      this->running_ = nullptr;
+      this->MakeReady(preempted, current_time);
     }
 
     //  Handle time quantum and determine if a conext switch is needed
     //  NOTE: Only does something for Schedulers which implement a round robin queue
-    //  in our case that is only Schedulers from the MLFQScheduler class
-    this->scheduler_->ManageTimeQuantum(this->GetRunning(), context_switch);
+    //  in our case that is only Schedulers from the MLFQScheduler class, so it is left
+    //  out at compile time for scheduler classes without a time quantum
+    if (SchedulerTraits<SchedulerT>::has_quantum) {
+      CountedCall(&this->counters_, SchedulerCall::kManageTimeQuantum,
+        [&] { this->scheduler_->ManageTimeQuantum(this->running_, context_switch); });
+      this->SyncRunning(current_time);
+    }
 
     //  if a context switch is required
     if (context_switch) {
       //  have the scheduler dispatch a new "running" Process
-      this->scheduler_->DispatchProcess(current_time);
+      this->Dispatch(current_time);
 
       //  Print the context switch details to console
-      this->PrintContext(current_time);
+      if (context != nullptr) this->PrintContext(*context, current_time);
     }
+
+    COUNTERS_ONLY(ready_length = this->scheduler_->QueueSize();)
+    COUNTERS_ONLY(this->counters_.SampleReadyLength(ready_length, 1);)
   }
 
-  //  When simulation is completed print results
-  this->PrintStats(current_time, idle_time);
+  //  When simulation is completed collect and print results
+  this->CollectResult(current_time, idle_time);
+  std::ostream *summary = this->sink_->summary_stream();
+  if (summary != nullptr) this->PrintStats(*summary, current_time, idle_time);
+  this->sink_->Flush();
 }
 
-//  Prints the statistics for the results of the simulation to the console
+//  Summarizes the completed simulation into result_
+//  The times of the Processes were collected into the histograms as they terminated
 //  First input: An integer representing the total time of the simulation
 //  Second input: An integer representing the total idle time of the simulation
 //  Returns nothing
-//  Ouputs simulation results to console
-void ProcessManager::PrintStats(int time, int idle) const {
-  cout << endl << endl << "Finished" << endl << endl;
-  cout << "Total Time:\t\t" << time << endl;
-  cout << "CPU Utilization:\t" << 100.0 * (time - idle) / time << "%";
-  cout << endl << endl;
-  this->PrintWaitTimes();
-  this->PrintTurnaroundTimes();
-  this->PrintResponseTimes();
-}
-
-//  Prints response times for each process and the average response time to the console
-//  Takes no inputs
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::CollectResult(int time, int idle) {
+  this->result_.process_count = this->stream_ != nullptr ? this->admitted_count_ :
+    static_cast<int>(this->jobs_.size());
+  this->result_.total_time = time;
+  this->result_.idle_time = idle;
+  this->result_.cpu_utilization = time > 0 ? 100.0 * (time - idle) / time : 0.0;
+  this->result_.wait = this->wait_histogram_.Summarize();
+  this->result_.turnaround = this->turnaround_histogram_.Summarize();
+  this->result_.response = this->response_histogram_.Summarize();
+  this->result_.average_wait = this->result_.wait.mean;
+  this->result_.average_turnaround = this->result_.turnaround.mean;
+  this->result_.average_response = this->result_.response.mean;
+}
+
+//  Determines the number of ticks until the next event of the simulation
+//  An event is the completion of the current CPU burst of the "running" Process,
+//  the completion of the current IO burst of a "waiting" Process, the expiry of
+//  the time quantum of the "running" Process, a change the scheduler makes to its
+//  queues on its own or the arrival of a Process
+//  NOTE: preemption and dispatch only happen when one of these events changes the
+//  ready queue or frees the CPU, so they need not be considered separately
+//  First input: An integer representing the current time of the simulation
+//  Returns an integer representing the number of ticks until the next event
+//  Returns 1 if no event is pending
+template <typename SchedulerT>
+int BasicProcessManager<SchedulerT>::TimeToNextEvent(int current_time) const {
+  int next_event = INT_MAX;
+
+  //  the "running" Process completes its CPU burst or exhausts its time quantum, or
+  //  the scheduler changes its queues on its own (e.g. a priority boost)
+  if (this->running_ != nullptr) next_event = this->running_->CurrentCPUTime();
+  if (SchedulerTraits<SchedulerT>::has_quantum) {
+    int quantum = CountedCall(&this->counters_, SchedulerCall::kQuantumRemaining,
+      [&] { return this->scheduler_->QuantumRemaining(this->running_); });
+    if (quantum > 0 && quantum < next_event) next_event = quantum;
+  }
+
+  //  a "waiting" Process completes its IO burst
+  int io = this->waiting_.MinRemaining();
+  if (io < next_event) next_event = io;
+
+  //  a "new" Process arrives
+  if (this->next_arrival_ < this->arrivals_.size()) {
+    int arrival = this->arrivals_[this->next_arrival_]->arrival_time() - current_time;
+    if (arrival < next_event) next_event = arrival;
+  }
+  if (this->stream_ != nullptr) {
+    int arrival = this->stream_->NextArrival();
+    if (arrival != INT_MAX && arrival - current_time < next_event) next_event = arrival - current_time;
+  }
+
+  if (next_event == INT_MAX) return 1;
+  return next_event;
+}
+
+//  Advances the "running" and "waiting" Processes by several ticks at once
+//  The caller guarantees that no event occurs during the skipped ticks
+//  NOTE: "ready" Processes need no update, their waiting time is charged on dispatch
+//  First input: An integer representing the number of ticks to skip
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::SkipTime(int ticks) {
+  if (this->running_ != nullptr) this->running_->DecrementCPU(ticks);
+  this->waiting_.Advance(ticks);
+  if (SchedulerTraits<SchedulerT>::has_quantum) {
+    CountedCall(&this->counters_, SchedulerCall::kSkipTimeQuantum,
+      [&] { this->scheduler_->SkipTimeQuantum(ticks); });
+  }
+}
+
+//  Prints the statistics for the results of the simulation
+//  The times of every Process are only listed for up to kMaxListedProcesses Processes
+//  and never for a stream, whose Processes are gone once they terminate. The averages
+//  and percentiles are always printed, followed by the counters when they are compiled in
+//  First input: A reference to the stream to print to
+//  Second input: An integer representing the total time of the simulation
+//  Third input: An integer representing the total idle time of the simulation
 //  Returns nothing
-//  Outputs response times for each process and average response time to the console
-void ProcessManager::PrintResponseTimes() const {
-  cout << "Reponse Times:\t\t";
-  this->PrintProcessNames();
-  cout << "\t\t\t";
-  int average_response_time = 0;
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::PrintStats(std::ostream &out, int time, int idle) const {
+  out << endl << endl << "Finished" << endl << endl;
+  out << "Total Time:\t\t" << time << endl;
+  out << "CPU Utilization:\t" << (time > 0 ? 100.0 * (time - idle) / time : 0.0) << "%";
+  out << endl << endl;
+  if (this->stream_ == nullptr && static_cast<int>(this->jobs_.size()) <= kMaxListedProcesses) {
+    this->PrintWaitTimes(out);
+    this->PrintTurnaroundTimes(out);
+    this->PrintResponseTimes(out);
+  }
+  PrintLatencyHeader(out);
+  PrintLatencyRow(out, "Wait", this->result_.wait);
+  PrintLatencyRow(out, "Turnaround", this->result_.turnaround);
+  PrintLatencyRow(out, "Response", this->result_.response);
+  out << endl;
+#ifdef SIMULATION_COUNTERS
+  PrintCounters(out, this->counters_);
+#endif
+}
+
+//  Prints response times for each process and the average response time
+//  NOTE: the average is taken from result_, which is filled once the simulation completes
+//  First input: A reference to the stream to print to
+//  Returns nothing
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::PrintResponseTimes(std::ostream &out) const {
+  out << "Reponse Times:\t\t";
+  this->PrintProcessNames(out);
+  out << "\t\t\t";
   for (vector<Process *>::const_iterator it = this->jobs_.begin();
     it != this->jobs_.end(); ++it) {
-    average_response_time += (*it)->response_time();
-    cout.width(5);
-    cout << std::left << (*it)->response_time();
-  } cout << endl;
-  cout << "Average Reponse:\t" << average_response_time / 8.0 << endl << endl;
+    out.width(5);
+    out << std::left << (*it)->response_time();
+  } out << endl;
+  out << "Average Reponse:\t" << this->result_.response.mean << endl << endl;
 }
 
-//  Prints turnaround times for each process and the average turnaround time to the console
-//  Takes no inputs
+//  Prints turnaround times for each process and the average turnaround time
+//  First input: A reference to the stream to print to
 //  Returns nothing
-//  Outputs turnaround times for each process and average turnaround time to the console
-void ProcessManager::PrintTurnaroundTimes() const {
-  cout << "Turnaround Times:\t";
-  this->PrintProcessNames();
-  cout << "\t\t\t";
-  int average_turnaround_time = 0;
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::PrintTurnaroundTimes(std::ostream &out) const {
+  out << "Turnaround Times:\t";
+  this->PrintProcessNames(out);
+  out << "\t\t\t";
   for (vector<Process *>::const_iterator it = this->jobs_.begin();
     it != this->jobs_.end(); ++it) {
-    average_turnaround_time += (*it)->turnaround_time();
-    cout.width(5);
-    cout << std::left << (*it)->turnaround_time();
-  } cout << endl;
-  cout << "Average Turnaround:\t" << average_turnaround_time / 8.0 << endl << endl;
+    out.width(5);
+    out << std::left << (*it)->turnaround_time();
+  } out << endl;
+  out << "Average Turnaround:\t" << this->result_.turnaround.mean << endl << endl;
 }
 
-//  Prints waiting times for each process and the average waiting time to the console
-//  Takes no inputs
+//  Prints waiting times for each process and the average waiting time
+//  First input: A reference to the stream to print to
 //  Returns nothing
-//  Outputs waiting times for each process and average waiting time to the console
-void ProcessManager::PrintWaitTimes() const {
-  cout << "Waiting Times:\t\t";
-  this->PrintProcessNames();
-  cout << "\t\t\t";
-  int average_waiting_time = 0;
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::PrintWaitTimes(std::ostream &out) const {
+  out << "Waiting Times:\t\t";
+  this->PrintProcessNames(out);
+  out << "\t\t\t";
   for (vector<Process *>::const_iterator it = this->jobs_.begin();
     it != this->jobs_.end(); ++it) {
-    average_waiting_time += (*it)->time_waiting();
-    cout.width(5);
-    cout << std::left << (*it)->time_waiting();
-  } cout << endl;
-  cout << "Average Wait:\t\t" << average_waiting_time / 8.0 << endl << endl;
+    out.width(5);
+    out << std::left << (*it)->time_waiting();
+  } out << endl;
+  out << "Average Wait:\t\t" << this->result_.wait.mean << endl << endl;
 }
 
-//  Prints process names to the console
-//  Takes no inputs
+//  Prints process names
+//  First input: A reference to the stream to print to
 //  Returns nothing
-//  Outputs process names to the console
-void ProcessManager::PrintProcessNames() const {
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::PrintProcessNames(std::ostream &out) const {
   for (vector<Process *>::const_iterator it = this->jobs_.begin();
     it != this->jobs_.end(); ++it) {
-    cout.width(5);
-    cout << std::left << (*it)->name();
-  } cout << endl;
+    out.width(5);
+    out << std::left << (*it)->name();
+  } out << endl;
 }
 
 //  Decrements current CPU burst of the current Process in "running" process state
@@ -236,15 +595,17 @@ void ProcessManager::PrintProcessNames() const {
 //  Second input: An integer representing the current run time of the simulation
 //  Third input: A reference to a boolean value representing the context switch flag
 //  Returns nothing
-void ProcessManager::ProcessRunning(Process *process, int current_time
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::ProcessRunning(Process *process, int current_time
   , bool &context_switch) {
   //  decrement the current CPU burst
   process->DecrementCPU();
 
   //  if the burst is completed
   if (process->CurrentCPUTime() == 0) {
-    //  set context switch flag to true
+    //  set context switch flag to true and free the CPU
     context_switch = true;
+    this->running_ = nullptr;
 
     //  pop completed CPU burst form CPU burst vector
     process->PopCPU();
@@ -252,7 +613,8 @@ void ProcessManager::ProcessRunning(Process *process, int current_time
     //  if the Process needs to complete an IO burst
     if (process->HasIO()) {
       //  set Process state to "waiting" and initialize priority to 0 for next potential CPU burst
-      process->set_state("waiting");
+      this->AddWaiting(process);
+      this->Record(EventType::kIOStart, current_time, process, process->CurrentIOTime());
       process->set_priority(0);
     } 
     
@@ -262,123 +624,122 @@ void ProcessManager::ProcessRunning(Process *process, int current_time
     //  general purpose
     else if (process->HasCPU()) {
       //  set Process state to "ready" and use scheduler to add Process to ready queue
-      process->set_state("ready");
-      this->scheduler_->AddProcess(process);
+      this->MakeReady(process, current_time);
     } 
     
     //  else the Process has no more CPU bursts or IO bursts
     else {
       //  set Process state to "terminated" and set turnaround time to current time
-      process->set_state("terminated");
-      process->set_turnaround_time(current_time);
+      this->Terminate(process, current_time);
     }
   }
 }
 
-//  Decrements current IO burst of the a Process in the "waiting" process state
-//  and determines if the a context switch is necessary
+//  Handles a Process in the "waiting" process state whose current IO burst has
+//  just completed and determines if the a context switch is necessary
+//  NOTE: the IO burst is decremented by SimulateScheduler for all "waiting" Processes
 //  First input: A pointer to a Process object in the "waiting" process state
 //  Second input: An integer representing the current run time of the simulation
 //  Third input: A reference to a boolean value representing the context switch flag
 //  Returns nothing
-void ProcessManager::ProcessWaiting(Process *process, int current_time,
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::ProcessWaiting(Process *process, int current_time,
   bool &context_switch) {
-  //  decrement the current IO burst
-  process->DecrementIO();
-
-  //  if the current IO burst is completed
-  if (process->CurrentIOTime() == 0) {
-
-    //  removed completed IO burst from the IO burst vector
-    process->PopIO();
-
-    //  if Process has another CPU burst to complete
-    if (process->HasCPU()) {
+  //  removed completed IO burst from the IO burst vector
+  process->PopIO();
 
-      //  if there is no "running" Process and the ready queue is empty
-      if (this->GetRunning() == nullptr && this->scheduler_->QueueEmpty()) {
+  //  if Process has another CPU burst to complete
+  if (process->HasCPU()) {
 
-        //  set context switch flag to true (the Process we are about to add will become
-        //  the new "running" Process)
-        context_switch = true;
-      }
+    //  if there is no "running" Process and the ready queue is empty
+    if (this->running_ == nullptr && this->scheduler_->QueueEmpty()) {
 
-      //  set the process state to "ready" and add it to the ready queue
-      process->set_state("ready");
-      this->scheduler_->AddProcess(process);
-    } 
-    
-    //  else if the Process has another IO burst to complete
-    //  NOTE: this should never happen for our case, because all of our Processes
-    //  follow a CPU, IO, CPU, IO, ... pattern, however, this is implemented for the
-    //  general purpose
-    else if (process->HasIO()) {
-      //  set the Process state to "waiting" and initialize the Process priority to
-      //  zero for any potential future times it will be added to ready queue
-      process->set_state("waiting");
-      process->set_priority(0);
-    } 
-    
-    //  else the Process has no more CPU or IO bursts
-    else {
-      
-      //  set the Process state to "terminated"
-      process->set_state("terminated");
-
-      //  set the turnarond time of the Process to the current time
-      process->set_turnaround_time(current_time);
+      //  set context switch flag to true (the Process we are about to add will become
+      //  the new "running" Process)
+      context_switch = true;
     }
+
+    //  set the process state to "ready" and add it to the ready queue
+    this->RemoveWaiting(process);
+    this->MakeReady(process, current_time);
+  } 
+  
+  //  else if the Process has another IO burst to complete
+  //  NOTE: this should never happen for our case, because all of our Processes
+  //  follow a CPU, IO, CPU, IO, ... pattern, however, this is implemented for the
+  //  general purpose
+  else if (process->HasIO()) {
+    //  the Process stays in the "waiting" process state, initialize the Process priority
+    //  to zero for any potential future times it will be added to ready queue
+    process->set_priority(0);
+    this->waiting_.Restart(process);
+  } 
+  
+  //  else the Process has no more CPU or IO bursts
+  else {
+    //  set the Process state to "terminated" and set the turnarond time of the
+    //  Process to the current time
+    this->RemoveWaiting(process);
+    this->Terminate(process, current_time);
   }
 }
 
-//  Prints the context switch to the console
-//  First input: An integer which represents the current time of the simulation
+//  Prints the details of a context switch
+//  First input: A reference to the stream to print to
+//  Second input: An integer which represents the current time of the simulation
 //  Returns nothing
-//  Outputs the details of a context switch to the console
-void ProcessManager::PrintContext(int current_time) const {
-  cout << endl << endl << "Current Time:\t" << current_time << endl << endl;
-  cout << "Now Running:\t";
-  if (this->GetRunning()) cout << this->GetRunning()->name() << " (" << this->GetRunning()->CurrentCPUTime() << ")" << endl;
-  else cout << "[idle]" << endl;
-  cout << ".................................................." << endl << endl;
-  this->scheduler_->PrintQueue();
-  cout << ".................................................." << endl << endl;
-  cout << "Now in I/O:\tProcess\t\tRemaining I/O time" << endl;
-  this->PrintCurrentIO();
-  cout << ".................................................." << endl;
-  if (this->HasTerminated()) this->PrintTerminated();
-  cout << ".................................................." << endl << endl;
-}
-
-//  Prints the processes which are currently waiting for IO to the console
-//  Takes no inputs
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::PrintContext(std::ostream &out, int current_time) const {
+  out << endl << endl << "Current Time:\t" << current_time << endl << endl;
+  out << "Now Running:\t";
+  if (this->GetRunning()) out << this->GetRunning()->name() << " (" << this->GetRunning()->CurrentCPUTime() << ")" << endl;
+  else out << "[idle]" << endl;
+  out << ".................................................." << endl << endl;
+  this->scheduler_->PrintQueue(out);
+  out << ".................................................." << endl << endl;
+  out << "Now in I/O:\tProcess\t\tRemaining I/O time" << endl;
+  this->PrintCurrentIO(out);
+  out << ".................................................." << endl;
+  if (this->HasTerminated()) this->PrintTerminated(out);
+  out << ".................................................." << endl << endl;
+}
+
+//  Prints the names and time remaining in IO for the processes which are currently
+//  in the "waiting" process state
+//  First input: A reference to the stream to print to
 //  Returns nothing
-//  Outputs the names and time remaining in IO for the processes which are currently
-//  in the "waiting" process state to the console
-void ProcessManager::PrintCurrentIO() const {
-  if (this->CountWaiting() == 0) cout << "\t\t[empty]" << endl << endl;
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::PrintCurrentIO(std::ostream &out) const {
+  if (this->waiting_.empty()) out << "\t\t[empty]" << endl << endl;
   else {
     for (vector<Process *>::const_iterator it = this->jobs_.begin();
       it != this->jobs_.end(); ++it) {
-      if ((*it)->state() == "waiting")
-        cout << "\t\t" << (*it)->name() << "\t\t" << (*it)->CurrentIOTime() << endl;
+      if (*it != nullptr && (*it)->state() == ProcessState::kWaiting)
+        out << "\t\t" << (*it)->name() << "\t\t" << this->waiting_.remaining(*it) << endl;
     }
   }
 }
 
 //  Prints the names of processes which are currently in the "terminated" process state
-//  Takes no inputs
+//  First input: A reference to the stream to print to
 //  Returns nothing
-//  Outputs the names of processes which are currently in the "terminated" process state
-void ProcessManager::PrintTerminated() const {
-  cout << endl << "Completed:\t";
+template <typename SchedulerT>
+void BasicProcessManager<SchedulerT>::PrintTerminated(std::ostream &out) const {
+  out << endl << "Completed:\t";
   for (vector<Process *>::const_iterator it = this->jobs_.begin();
     it != this->jobs_.end(); ++it) {
-    if ((*it)->state() == "terminated") {
-      cout.width(5);
-      cout << std::left << (*it)->name();
+    if (*it != nullptr && (*it)->state() == ProcessState::kTerminated) {
+      out.width(5);
+      out << std::left << (*it)->name();
     }
   }
-  cout << endl << endl;
-  cout << ".................................................." << endl;
-}
\ No newline at end of file
+  out << endl << endl;
+  out << ".................................................." << endl;
+}
+
+//  the scheduler selected at run time and every scheduler of this repository
+template class BasicProcessManager<Scheduler>;
+template class BasicProcessManager<FCFSScheduler>;
+template class BasicProcessManager<SJFScheduler>;
+template class BasicProcessManager<MLFQScheduler>;
+template class BasicProcessManager<SRTFScheduler>;
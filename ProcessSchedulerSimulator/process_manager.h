@@ -1,45 +1,150 @@
 #ifndef PROCESS_MANAGER_H_
 #define PROCESS_MANAGER_H_
 
+#include "arrival_stream.h"
+#include "latency_histogram.h"
+#include "output_sink.h"
 #include "process.h"
 #include "scheduler.h"
+#include "simulation_counters.h"
+#include "waiting_table.h"
 
+#include <memory>
+#include <ostream>
 #include <vector>
 using std::vector;
 
-class ProcessManager {
+//  Selects how the simulation clock is advanced
+//  kTickEngine advances the clock one time unit at a time
+//  kEventEngine jumps the clock directly to the next time unit in which an event occurs
+enum EngineMode { kTickEngine, kEventEngine };
+
+//  The time accounting of one CPU of a MultiCoreManager
+struct CoreStats {
+  long long busy_time;        //  ticks in which a Process was "running" on the CPU
+  long long idle_time;        //  ticks in which the CPU had nothing to run
+  long long migration_time;   //  ticks the CPU spent moving stolen Processes to its run queue
+  long long dispatches;       //  Processes dispatched by the CPU's scheduler
+  long long steals;           //  Processes the CPU stole from the run queues of other CPUs
+};
+
+//  The summary of a completed simulation
+//  Averages and percentiles are taken over every Process in the jobs queue, or every
+//  Process admitted from the stream
+struct SimulationResult {
+  int process_count;            //  the number of Processes simulated
+  int total_time;               //  the time at which the last Process terminated
+  int idle_time;                //  the time during which no Process was "running"
+  double cpu_utilization;       //  the percentage of the total time in which the CPU was busy
+  double average_wait;          //  the average time spent in the "ready" state
+  double average_turnaround;    //  the average time from arrival to termination
+  double average_response;      //  the average time from arrival to first dispatch
+  LatencySummary wait;          //  the distribution of the time spent in the "ready" state
+  LatencySummary turnaround;    //  the distribution of the time from arrival to termination
+  LatencySummary response;      //  the distribution of the time from arrival to first dispatch
+  //  the accounting of the CPUs, only filled in by a MultiCoreManager (empty or 0 otherwise)
+  vector<CoreStats> cores;      //  the time accounting of each CPU
+  long long migrations;         //  the number of Processes which migrated between CPUs
+  double load_imbalance;        //  the busy time of the busiest CPU over the mean busy time
+  double busy_stddev;           //  the standard deviation of the busy times of the CPUs
+};
+
+//  Simulates a single CPU running the jobs queue with a scheduler of type SchedulerT
+//  With SchedulerT = Scheduler (ProcessManager) the scheduler is selected at run time
+//  and every call goes through the Scheduler interface. With a final scheduler class
+//  the calls are resolved at compile time, and the hooks its SchedulerTraits declare
+//  unused (time quantum, preemption) are left out of the simulation loop entirely.
+//  Both produce identical simulations.
+//  Processes in the "new" process state enter the ready queue at their arrival times.
+//  They either come from the jobs queue or, when a stream is set, from an ArrivalStream
+//  which hands them out while the simulation runs. Streamed Processes are added to the
+//  jobs queue on arrival and removed from it when they terminate, their ids are reused.
+//  NOTE: the member functions are defined in process_manager.cpp, which instantiates
+//  the template for Scheduler, FCFSScheduler, SJFScheduler, MLFQScheduler and SRTFScheduler
+template <typename SchedulerT>
+class BasicProcessManager {
 public:
+  static const int kMaxListedProcesses = 16;  //  above this the statistics omit the per Process times
+
   //  constructors
-  ProcessManager(const vector<Process*> &, Scheduler *);
+  BasicProcessManager(const vector<Process*> &, SchedulerT *);
+  BasicProcessManager(const vector<Process*> &, SchedulerT *, EngineMode);
 
   //  methods
   bool AllTerminated() const;
   int CountWaiting() const;
   Process *GetRunning() const;
   bool HasTerminated() const;
-  void PrintContext(int) const;
-  void PrintCurrentIO() const;
-  void PrintProcessNames() const;
-  void PrintResponseTimes() const;
-  void PrintStats(int, int) const;
-  void PrintTerminated() const;
-  void PrintTurnaroundTimes() const;
-  void PrintWaitTimes() const;
+  void PrintContext(std::ostream &, int) const;
+  void PrintCurrentIO(std::ostream &) const;
+  void PrintProcessNames(std::ostream &) const;
+  void PrintResponseTimes(std::ostream &) const;
+  void PrintStats(std::ostream &, int, int) const;
+  void PrintTerminated(std::ostream &) const;
+  void PrintTurnaroundTimes(std::ostream &) const;
+  void PrintWaitTimes(std::ostream &) const;
   void ProcessRunning(Process *, int, bool &);
   void ProcessWaiting(Process *, int, bool &);
+  void Reset();
   void SimulateScheduler();
+  void SkipTime(int);
+  int TimeToNextEvent(int) const;
 
   //  getters
+  EngineMode engine_mode() const { return this->engine_mode_; }
   const vector<Process *> &jobs() const { return this->jobs_; }
-  Scheduler *scheduler() const { return this->scheduler_; }
+  const SimulationCounters &counters() const { return this->counters_; }
+  const SimulationResult &result() const { return this->result_; }
+  SchedulerT *scheduler() const { return this->scheduler_; }
+  OutputSink *sink() const { return this->sink_; }
+  ArrivalStream *stream() const { return this->stream_; }
 
   //  setters
-  void set_jobs(const vector<Process *> &jobs) { this->jobs_ = jobs; }
-  void set_scheduler(Scheduler *scheduler) { this->scheduler_ = scheduler; }
+  void set_engine_mode(EngineMode mode) { this->engine_mode_ = mode; }
+  void set_jobs(const vector<Process *> &jobs) { this->jobs_ = jobs; this->TrackJobs(); }
+  void set_scheduler(SchedulerT *scheduler) { this->scheduler_ = scheduler; }
+  void set_sink(OutputSink *);
+  //  NOTE: a stream is meant for a manager constructed with an empty jobs queue, and a
+  //  simulation driven by a stream cannot be rewound with Reset
+  void set_stream(ArrivalStream *stream) { this->stream_ = stream; this->TrackJobs(); }
 
 private:
-  Scheduler *scheduler_;    //  A pointer to the scheduler which is to be used for the simulation
-  vector<Process *> jobs_;  //  A vector of pointers to the Process objects which are to be simulated
+  //  bookkeeping for process state transitions
+  void AddWaiting(Process *);
+  void AdmitArrivals(int, bool &);
+  void Arrive(Process *, int, bool &);
+  void CollectResult(int, int);
+  void Record(EventType, int, const Process *, int);
+  void Dispatch(int);
+  void MakeReady(Process *, int);
+  void RemoveWaiting(Process *);
+  void SyncRunning(int);
+  void Terminate(Process *, int);
+  void TrackJobs();
+
+  SchedulerT *scheduler_;         //  A pointer to the scheduler which is to be used for the simulation
+  vector<Process *> jobs_;        //  A vector of pointers to the Process objects which are to be simulated
+  EngineMode engine_mode_;        //  The engine used to advance the clock of the simulation
+  OutputSink *sink_;              //  The destination of the output of the simulation (not owned)
+  std::unique_ptr<OutputSink> console_sink_;  //  The default sink, which prints everything to console
+  bool record_events_;            //  Whether the sink keeps an event log, cached for the simulation
+  SimulationResult result_;       //  The summary of the last completed simulation
+  LatencyHistogram wait_histogram_;         //  The waiting times of the terminated Processes
+  LatencyHistogram turnaround_histogram_;   //  The turnaround times of the terminated Processes
+  LatencyHistogram response_histogram_;     //  The response times of the terminated Processes
+  mutable SimulationCounters counters_;     //  The counters of the last simulation (also updated by const queries)
+  Process *running_;              //  A pointer to the Process in the "running" state (nullptr if the CPU is idle)
+  WaitingTable waiting_;          //  The Processes in the "waiting" state and their remaining IO times
+  vector<Process *> io_completed_;  //  The Processes which completed an IO burst in the current tick
+  int terminated_count_;          //  The number of Processes in the "terminated" state
+  vector<Process *> arrivals_;    //  The "new" Processes of the jobs queue in order of arrival
+  vector<Process *>::size_type next_arrival_;   //  The position in arrivals_ of the next Process to arrive
+  ArrivalStream *stream_;         //  The source of Processes arriving during the simulation (not owned, may be nullptr)
+  vector<int> free_ids_;          //  The ids of terminated streamed Processes, reused for the next arrivals
+  int admitted_count_;            //  The number of Processes admitted from the stream
 };
 
+//  The ProcessManager for schedulers selected at run time
+typedef BasicProcessManager<Scheduler> ProcessManager;
+
 #endif  //  PROCESS_MANAGER_H_
\ No newline at end of file
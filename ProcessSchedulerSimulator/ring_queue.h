@@ -0,0 +1,109 @@
+#ifndef RING_QUEUE_H_
+#define RING_QUEUE_H_
+
+#include <cstddef>
+#include <vector>
+using std::vector;
+
+//  A growable first in first out queue stored in a ring buffer
+//  push_back and pop_front are O(1) and never move the other elements
+//  The capacity is always a power of two and only grows when the queue is full,
+//  so a queue which has reached its steady state size never reallocates
+template <typename T>
+class RingQueue {
+public:
+  //  A forward iterator which visits the queue from front to back without copying it
+  class const_iterator {
+  public:
+    const_iterator(const RingQueue *queue, size_t index) : queue_(queue), index_(index) {}
+    const T &operator*() const { return (*this->queue_)[this->index_]; }
+    const T *operator->() const { return &(*this->queue_)[this->index_]; }
+    const_iterator &operator++() { ++this->index_; return *this; }
+    bool operator==(const const_iterator &other) const { return this->index_ == other.index_; }
+    bool operator!=(const const_iterator &other) const { return this->index_ != other.index_; }
+  private:
+    const RingQueue *queue_;  //  the queue being iterated
+    size_t index_;            //  position relative to the front of the queue
+  };
+
+  //  constructors
+  RingQueue() : head_(0), size_(0) {}
+  explicit RingQueue(const vector<T> &items) : head_(0), size_(0) { this->assign(items); }
+
+  //  methods
+  const T &operator[](size_t index) const { return this->buffer_[(this->head_ + index) & this->mask()]; }
+  T &operator[](size_t index) { return this->buffer_[(this->head_ + index) & this->mask()]; }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, this->size_); }
+  bool empty() const { return this->size_ == 0; }
+  size_t size() const { return this->size_; }
+  size_t capacity() const { return this->buffer_.size(); }
+  const T &front() const { return this->buffer_[this->head_]; }
+  T &front() { return this->buffer_[this->head_]; }
+  const T &back() const { return (*this)[this->size_ - 1]; }
+  T &back() { return (*this)[this->size_ - 1]; }
+
+  //  Adds an item to the back of the queue, doubling the capacity if the queue is full
+  //  First input: A constant reference to the item to be added
+  //  Returns nothing
+  void push_back(const T &item) {
+    if (this->size_ == this->buffer_.size()) this->reserve(this->size_ + 1);
+    this->buffer_[(this->head_ + this->size_) & this->mask()] = item;
+    ++this->size_;
+  }
+
+  //  Removes the item at the front of the queue
+  //  Should only be called on a queue which is not empty
+  //  Returns nothing
+  void pop_front() {
+    this->head_ = (this->head_ + 1) & this->mask();
+    --this->size_;
+  }
+
+  //  Removes the item at the back of the queue
+  //  Should only be called on a queue which is not empty
+  //  Returns nothing
+  void pop_back() {
+    --this->size_;
+  }
+
+  //  Removes every item from the queue while keeping the capacity
+  //  Returns nothing
+  void clear() {
+    this->head_ = 0;
+    this->size_ = 0;
+  }
+
+  //  Replaces the contents of the queue with the items of a vector (front first)
+  //  First input: A constant reference to a vector of the items to be queued
+  //  Returns nothing
+  void assign(const vector<T> &items) {
+    this->clear();
+    this->reserve(items.size());
+    for (typename vector<T>::const_iterator it = items.begin(); it != items.end(); ++it)
+      this->push_back(*it);
+  }
+
+  //  Grows the capacity to the smallest power of two which holds the given number of items
+  //  The items are moved so that the front of the queue is at the start of the buffer
+  //  First input: The number of items the queue should be able to hold without growing
+  //  Returns nothing
+  void reserve(size_t count) {
+    if (count <= this->buffer_.size()) return;
+    size_t capacity = this->buffer_.empty() ? 8 : this->buffer_.size();
+    while (capacity < count) capacity *= 2;
+    vector<T> buffer(capacity);
+    for (size_t i = 0; i < this->size_; ++i) buffer[i] = (*this)[i];
+    this->buffer_.swap(buffer);
+    this->head_ = 0;
+  }
+
+private:
+  size_t mask() const { return this->buffer_.size() - 1; }
+
+  vector<T> buffer_;  //  storage for the ring buffer, its size is the capacity of the queue
+  size_t head_;       //  index in the buffer of the front of the queue
+  size_t size_;       //  number of items in the queue
+};
+
+#endif  //  RING_QUEUE_H_
\ No newline at end of file
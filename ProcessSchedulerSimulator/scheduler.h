@@ -3,9 +3,22 @@
 
 #include "process.h"
 
+#include <ostream>
+#include <vector>
+using std::vector;
+
 //  An interface to be implemented by all scheduler classes
+//  A scheduler class may also declare which optional hooks it needs by redefining
+//  kHasQuantum and kPreemptive, see SchedulerTraits
 class Scheduler {
 public:
+  //  capabilities, unknown for a scheduler selected at run time
+  static constexpr bool kHasQuantum = true;   //  ManageTimeQuantum/QuantumRemaining/SkipTimeQuantum do something
+  static constexpr bool kPreemptive = true;   //  Preemption may return true
+
+  //  Schedulers are destroyed through pointers to this interface
+  virtual ~Scheduler() {}
+
   //  Add a process to the ready queue
   //  First input: A pointer to the Process which is to be added to the ready queue
   //  Returns nothing
@@ -15,8 +28,15 @@ public:
   //  Changes state of next Process from "ready" to "running"
   //  Also sets response flag/response time if next Process is entering "running" state for the firs time
   //  First input: an integer representing the current time of the process manager (used to set response time if necessary)
-  //  Returns nothing
-  virtual void DispatchProcess(int) = 0;
+  //  Returns a pointer to the dispatched Process
+  //  Returns nullptr if the ready queue(s) are all empty
+  virtual Process *DispatchProcess(int) = 0;
+
+  //  Finds the ready queue the last Process returned by DispatchProcess came from
+  //  Takes no inputs
+  //  Returns the level of the queue, 0 being the highest priority
+  //  Returns 0 for schedulers with a single ready queue
+  virtual int DispatchLevel() const = 0;
 
   //  Manages time quantum for round robin schedulers and determines whether a context switch is needed
   //  First input: A pointer to the Process which is currently in the "running" state
@@ -30,16 +50,59 @@ public:
   //  Returns false if preemptive context switch is not necessary
   virtual bool Preemption(Process *) const = 0;
 
+  //  Determines how many ticks remain before ManageTimeQuantum changes the schedule, e.g.
+  //  when the time quantum of the running Process expires
+  //  First input: A pointer to a Process which is in the "running" state (nullptr if none)
+  //  Returns the number of ticks until ManageTimeQuantum may force a context switch
+  //  Returns -1 if nothing is due, e.g. the running Process is not subject to a time quantum
+  virtual int QuantumRemaining(const Process *) const = 0;
+
+  //  Advances the time quantum by several ticks at once without checking for a context switch
+  //  Used by the event engine to skip ticks in which nothing can happen
+  //  First input: An integer representing the number of ticks which have elapsed
+  //  Returns nothing
+  virtual void SkipTimeQuantum(int) = 0;
+
   //  Prints the ready queue(s) for the scheduler
-  //  Takes not inputs
+  //  First input: A reference to the stream to print to, provided by the OutputSink
   //  Returns nothing
-  virtual void PrintQueue() const = 0;
+  virtual void PrintQueue(std::ostream &) const = 0;
 
   //  Determines whether the ready queue(s) are all empty
   //  Takes no inputs
   //  Returns true if all of the scheduler's ready queues are empty
   //  Returns false if any of the scheduler's ready queue are not empty
   virtual bool QueueEmpty() const = 0;
+
+  //  Counts the Processes in the ready queue(s)
+  //  Takes no inputs
+  //  Returns the number of Processes in the "ready" state held by the scheduler
+  virtual int QueueSize() const = 0;
+
+  //  Returns the scheduler to the state it was constructed in with a new set of Processes
+  //  in the ready queue, keeping the storage of its queues so that a simulation can be
+  //  run again without allocating
+  //  First input: A constant reference to a vector of pointers to the Processes, of which
+  //  those in the "ready" process state start in the ready queue
+  //  Returns nothing
+  virtual void Reset(const vector<Process *> &) = 0;
+
+  //  Removes a Process from the ready queue(s) so that it can migrate to another CPU
+  //  The Process taken is one which would be dispatched late, and it is left so that
+  //  AddProcess of another scheduler of the same kind puts it in an equivalent queue
+  //  Takes no inputs
+  //  Returns a pointer to the removed Process
+  //  Returns nullptr if the ready queue(s) are all empty
+  virtual Process *StealProcess() = 0;
+};
+
+//  The capabilities of a scheduler class known at compile time
+//  A BasicProcessManager leaves out the calls of the hooks a scheduler does not need,
+//  which is only possible when the scheduler class is known at compile time
+template <typename SchedulerT>
+struct SchedulerTraits {
+  static constexpr bool has_quantum = SchedulerT::kHasQuantum;  //  whether the time quantum hooks are called
+  static constexpr bool preemptive = SchedulerT::kPreemptive;   //  whether Preemption is called
 };
 
 #endif // SCHEDULER_H_
\ No newline at end of file
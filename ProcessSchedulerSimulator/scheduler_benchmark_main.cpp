@@ -0,0 +1,179 @@
+#include "latency_histogram.h"
+#include "process.h"
+#include "scheduler.h"
+#include "scheduler_config.h"
+#include "workload_generator.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+//  Receives the results of the timed calls which are otherwise unused, so that the
+//  calls cannot be optimized away
+static volatile bool result_sink;
+
+//  The latency distributions of the scheduler calls at one ready queue depth
+struct CallLatencies {
+  LatencyHistogram add;         //  AddProcess
+  LatencyHistogram dispatch;    //  DispatchProcess
+  LatencyHistogram preemption;  //  Preemption
+  LatencyHistogram quantum;     //  ManageTimeQuantum
+};
+
+//  Measures the time between two readings of the clock
+//  Takes no inputs
+//  Returns the median overhead of one timed call in nanoseconds
+static int TimerOverhead() {
+  LatencyHistogram overhead;
+  for (int i = 0; i < 100000; ++i) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    overhead.Add(static_cast<int>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+      end - start).count()));
+  }
+  return overhead.Percentile(50.0);
+}
+
+//  Nanoseconds elapsed between two readings of the clock
+//  First input: The first reading
+//  Second input: The second reading
+//  Returns the elapsed time, clamped to the range of an int
+static int Elapsed(std::chrono::steady_clock::time_point start,
+  std::chrono::steady_clock::time_point end) {
+  long long elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  return elapsed > 0x7fffffff ? 0x7fffffff : static_cast<int>(elapsed);
+}
+
+//  Times every scheduler call with a ready queue held at a fixed depth
+//  Each cycle dispatches the next Process, asks whether it would be preempted, runs one
+//  tick of its time quantum and adds it back to the ready queue, so the depth is the
+//  same before every dispatch. The CPU bursts never complete, so every Process stays
+//  schedulable; their lengths are random so that SJF has to order them.
+//  First input: A constant reference to the scheduler configuration
+//  Second input: The number of Processes in the ready queue
+//  Third input: The number of timed cycles
+//  Fourth input: The seed of the random burst lengths
+//  Returns the latency distributions of the calls
+static CallLatencies Measure(const SchedulerConfig &config, int depth, int cycles, uint64_t seed) {
+  RandomGenerator random(seed);
+  vector<int> bursts(depth);
+  for (vector<int>::iterator it = bursts.begin(); it != bursts.end(); ++it)
+    *it = 1000000 + static_cast<int>(random.NextU64() % 1000000);
+  vector<Process> processes;
+  processes.reserve(depth);
+  for (int i = 0; i < depth; ++i) {
+    processes.push_back(Process(BurstList(&bursts[i], 1), BurstList(), "P", 1, ProcessState::kReady));
+    processes.back().set_id(i);
+  }
+  vector<Process *> jobs;
+  jobs.reserve(depth);
+  for (vector<Process>::iterator it = processes.begin(); it != processes.end(); ++it)
+    jobs.push_back(&*it);
+
+  Scheduler *scheduler = config.Create(jobs);
+  CallLatencies latencies;
+  int warmup = depth < 10000 ? depth : 10000;
+  for (int cycle = -warmup; cycle < cycles; ++cycle) {
+    bool context_switch = false;
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    Process *running = scheduler->DispatchProcess(cycle);
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    result_sink = scheduler->Preemption(running);
+    std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+    scheduler->ManageTimeQuantum(running, context_switch);
+    std::chrono::steady_clock::time_point t3 = std::chrono::steady_clock::now();
+
+    //  an expired time quantum already returned the Process to the ready queue
+    bool requeued = running->state() == ProcessState::kReady;
+    std::chrono::steady_clock::time_point t4 = t3;
+    std::chrono::steady_clock::time_point t5 = t3;
+    if (!requeued) {
+      running->set_state(ProcessState::kReady);
+      t4 = std::chrono::steady_clock::now();
+      scheduler->AddProcess(running);
+      t5 = std::chrono::steady_clock::now();
+    }
+    if (cycle < 0) continue;
+    latencies.dispatch.Add(Elapsed(t0, t1));
+    latencies.preemption.Add(Elapsed(t1, t2));
+    latencies.quantum.Add(Elapsed(t2, t3));
+    if (!requeued) latencies.add.Add(Elapsed(t4, t5));
+  }
+  delete scheduler;
+  return latencies;
+}
+
+//  Parses a comma separated list of ready queue depths
+//  First input: A pointer to the list
+//  Second input: A pointer to the vector which receives the depths
+//  Returns true if every entry is a positive number
+static bool ParseDepths(const char *list, vector<int> *depths) {
+  depths->clear();
+  std::stringstream stream(list);
+  string entry;
+  while (std::getline(stream, entry, ',')) {
+    char *end = nullptr;
+    long depth = std::strtol(entry.c_str(), &end, 10);
+    if (entry.empty() || *end != '\0' || depth <= 0) return false;
+    depths->push_back(static_cast<int>(depth));
+  }
+  return !depths->empty();
+}
+
+//  Measures the latency of every call of the Scheduler interface for FCFS, SJF, MLFQ and SRTF
+//  at ready queue depths from 1 to 1M and prints their distributions in nanoseconds
+//  Usage: RunSchedulerBenchmark [-d depth,depth,...] [-c cycles] [-s seed]
+//  NOTE: every timed call includes the overhead of reading the clock, which is printed
+//  first
+int main(int argc, char *argv[]) {
+  vector<int> depths = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+  int cycles = 200000;
+  uint64_t seed = 1;
+  for (int i = 1; i < argc; ++i) {
+    string option = argv[i];
+    if (i + 1 < argc && option == "-d" && ParseDepths(argv[i + 1], &depths)) {
+      ++i;
+    } else if (i + 1 < argc && option == "-c" && std::atoi(argv[i + 1]) > 0) {
+      cycles = std::atoi(argv[++i]);
+    } else if (i + 1 < argc && option == "-s") {
+      seed = std::strtoull(argv[++i], nullptr, 10);
+    } else {
+      cerr << "Usage: " << argv[0] << " [-d depth,depth,...] [-c cycles] [-s seed]" << endl;
+      return 2;
+    }
+  }
+
+  vector<SchedulerConfig> configs;
+  SchedulerConfig fcfs = { SchedulerKind::kFCFS, kEventEngine, 1, 0, vector<int>(), 0 };
+  SchedulerConfig sjf = { SchedulerKind::kSJF, kEventEngine, 1, 0, vector<int>(), 0 };
+  SchedulerConfig mlfq = { SchedulerKind::kMLFQ, kEventEngine, 1, 0, vector<int>(), 0 };
+  SchedulerConfig srtf = { SchedulerKind::kSRTF, kEventEngine, 1, 0, vector<int>(), 0 };
+  configs.push_back(fcfs);
+  configs.push_back(sjf);
+  configs.push_back(mlfq);
+  configs.push_back(srtf);
+
+  cout << "Timer overhead: " << TimerOverhead() << " ns per call (included below)" << endl;
+  for (vector<SchedulerConfig>::const_iterator config = configs.begin();
+    config != configs.end(); ++config) {
+    for (vector<int>::const_iterator depth = depths.begin(); depth != depths.end(); ++depth) {
+      CallLatencies latencies = Measure(*config, *depth, cycles, seed);
+      string name = config->Name();
+      cout << endl << name.substr(0, name.find('/')) << "  depth " << *depth << "  (ns per call)" << endl;
+      PrintLatencyHeader(cout);
+      PrintLatencyRow(cout, "Add", latencies.add.Summarize());
+      PrintLatencyRow(cout, "Dispatch", latencies.dispatch.Summarize());
+      PrintLatencyRow(cout, "Preemption", latencies.preemption.Summarize());
+      PrintLatencyRow(cout, "Quantum", latencies.quantum.Summarize());
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,99 @@
+#include "fcfs_scheduler.h"
+#include "mlfq_scheduler.h"
+#include "scheduler_config.h"
+#include "sjf_scheduler.h"
+#include "srtf_scheduler.h"
+
+#include <string>
+using std::to_string;
+
+//  Creates a new scheduler of the configured kind for a set of Processes
+//  First input: A constant reference to a vector of pointers to the Processes
+//  which start in the ready queue
+//  Returns a pointer to the new Scheduler, owned by the caller
+Scheduler *SchedulerConfig::Create(const vector<Process *> &jobs) const {
+  switch (this->kind) {
+  case SchedulerKind::kFCFS:
+    return new FCFSScheduler(jobs);
+  case SchedulerKind::kSJF:
+    return new SJFScheduler(jobs);
+  case SchedulerKind::kMLFQ:
+    return new MLFQScheduler(jobs, this->quanta, this->boost_interval);
+  case SchedulerKind::kSRTF:
+    return new SRTFScheduler(jobs);
+  }
+  return nullptr;
+}
+
+//  Runs a simulation on a single CPU with a scheduler whose class is known at compile time
+//  First input: A pointer to the scheduler
+//  Second input: A constant reference to a vector of pointers to the Processes
+//  Third input: The engine which advances the clock
+//  Fourth input: A pointer to the sink the output goes to (nullptr for console)
+//  Returns the summary of the simulation
+template <typename SchedulerT>
+static SimulationResult SimulateWith(SchedulerT *scheduler, const vector<Process *> &jobs,
+  EngineMode engine, OutputSink *sink) {
+  BasicProcessManager<SchedulerT> simulator(jobs, scheduler, engine);
+  simulator.set_sink(sink);
+  simulator.SimulateScheduler();
+  return simulator.result();
+}
+
+//  Simulates a set of Processes on a single CPU with a new scheduler of the configured
+//  kind, ignoring cores and migration_cost
+//  Unlike simulating the scheduler returned by Create, the scheduler calls are
+//  resolved at compile time, with identical results
+//  First input: A constant reference to a vector of pointers to the Processes
+//  which start in the ready queue
+//  Second input: A pointer to the sink the output goes to (nullptr for console)
+//  Returns the summary of the simulation
+SimulationResult SchedulerConfig::Simulate(const vector<Process *> &jobs, OutputSink *sink) const {
+  switch (this->kind) {
+  case SchedulerKind::kFCFS: {
+    FCFSScheduler scheduler(jobs);
+    return SimulateWith(&scheduler, jobs, this->engine, sink);
+  }
+  case SchedulerKind::kSJF: {
+    SJFScheduler scheduler(jobs);
+    return SimulateWith(&scheduler, jobs, this->engine, sink);
+  }
+  case SchedulerKind::kMLFQ: {
+    MLFQScheduler scheduler(jobs, this->quanta, this->boost_interval);
+    return SimulateWith(&scheduler, jobs, this->engine, sink);
+  }
+  case SchedulerKind::kSRTF: {
+    SRTFScheduler scheduler(jobs);
+    return SimulateWith(&scheduler, jobs, this->engine, sink);
+  }
+  }
+  return SimulationResult();
+}
+
+//  Names the configuration for result tables
+//  Takes no inputs
+//  Returns the name of the algorithm followed by the engine and, for more than one
+//  CPU, the number of CPUs, e.g. "MLFQ/event" or "SJF/tick/x64"
+//  A MLFQ shape other than the default is listed after the name, e.g. "MLFQ[8,16,0;b500]"
+//  where a quantum of 0 is a FCFS level and b is the boost interval
+string SchedulerConfig::Name() const {
+  string name;
+  switch (this->kind) {
+  case SchedulerKind::kFCFS: name = "FCFS"; break;
+  case SchedulerKind::kSJF:  name = "SJF"; break;
+  case SchedulerKind::kMLFQ: name = "MLFQ"; break;
+  case SchedulerKind::kSRTF: name = "SRTF"; break;
+  }
+  if (this->kind == SchedulerKind::kMLFQ && (!this->quanta.empty() || this->boost_interval > 0)) {
+    vector<int> shape = this->quanta.empty() ? MLFQScheduler::DefaultQuanta() : this->quanta;
+    name += "[";
+    if (shape.size() > MLFQScheduler::kMaxLevels) shape.resize(MLFQScheduler::kMaxLevels);
+    for (vector<int>::size_type i = 0; i < shape.size(); ++i)
+      name += (i > 0 ? "," : "") + to_string(shape[i] > 0 ? shape[i] : 0);
+    if (this->boost_interval > 0) name += ";b" + to_string(this->boost_interval);
+    name += "]";
+  }
+  name += this->engine == kEventEngine ? "/event" : "/tick";
+  if (this->cores > 1) name += "/x" + to_string(this->cores);
+  return name;
+}
@@ -0,0 +1,35 @@
+#ifndef SCHEDULER_CONFIG_H_
+#define SCHEDULER_CONFIG_H_
+
+#include "output_sink.h"
+#include "process.h"
+#include "process_manager.h"
+#include "scheduler.h"
+
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+//  The scheduling algorithms which may be simulated
+enum class SchedulerKind { kFCFS, kSJF, kMLFQ, kSRTF };
+
+//  A complete description of how to simulate a workload: the algorithm, the engine
+//  used to run it and the machine it runs on
+//  A configuration with cores of 0 or 1 is simulated by a ProcessManager, otherwise
+//  by a MultiCoreManager in which every core has its own scheduler of this kind
+struct SchedulerConfig {
+  SchedulerKind kind;   //  the scheduling algorithm
+  EngineMode engine;    //  the engine which advances the clock
+  int cores;            //  the number of CPUs (0 is treated as 1)
+  int migration_cost;   //  ticks a CPU spends moving a stolen Process to its run queue
+  vector<int> quanta;   //  MLFQ: the time quantum of each level, empty for the default shape
+  int boost_interval;   //  MLFQ: ticks between priority boosts, 0 for none
+
+  //  methods
+  Scheduler *Create(const vector<Process *> &) const;
+  string Name() const;
+  SimulationResult Simulate(const vector<Process *> &, OutputSink *) const;
+};
+
+#endif  //  SCHEDULER_CONFIG_H_
@@ -0,0 +1,43 @@
+#include "simulation_arena.h"
+
+//  Creates a new scheduler of a configured kind for the jobs queue, owned by the arena
+//  The scheduler the arena held before is released
+//  First input: A constant reference to the scheduler configuration
+//  Returns a pointer to the new Scheduler, valid until the arena releases it
+Scheduler *SimulationArena::CreateScheduler(const SchedulerConfig &config) {
+  return this->Adopt(config.Create(this->jobs_));
+}
+
+//  Replaces the Processes of the arena with those of a workload, in their initial
+//  process state (see Workload::CreateProcess), and releases the scheduler
+//  The storage of the previous Processes is reused when it is large enough
+//  First input: A constant reference to the workload, which must outlive the arena
+//  Returns nothing
+void SimulationArena::Load(const Workload &workload) {
+  this->scheduler_.reset();
+  this->processes_.clear();
+  this->processes_.reserve(workload.size());
+  for (size_t i = 0; i < workload.size(); ++i) this->processes_.push_back(workload.CreateProcess(i));
+  this->jobs_.clear();
+  this->jobs_.reserve(this->processes_.size());
+  for (vector<Process>::iterator it = this->processes_.begin(); it != this->processes_.end(); ++it)
+    this->jobs_.push_back(&*it);
+}
+
+//  Releases every Process and the scheduler at once, returning their storage
+//  Takes no inputs
+//  Returns nothing
+void SimulationArena::Release() {
+  this->scheduler_.reset();
+  vector<Process>().swap(this->processes_);
+  vector<Process *>().swap(this->jobs_);
+}
+
+//  Returns every Process to its initial state (see Process::Reset)
+//  The scheduler is not changed, use BasicProcessManager::Reset to rewind both
+//  Takes no inputs
+//  Returns nothing
+void SimulationArena::Rewind() {
+  for (vector<Process>::iterator it = this->processes_.begin(); it != this->processes_.end(); ++it)
+    it->Reset();
+}
@@ -0,0 +1,68 @@
+#ifndef SIMULATION_ARENA_H_
+#define SIMULATION_ARENA_H_
+
+#include "process.h"
+#include "scheduler.h"
+#include "scheduler_config.h"
+#include "workload.h"
+
+#include <memory>
+#include <vector>
+using std::vector;
+
+//  Owns every Process and the scheduler of one simulation and releases them together
+//  The Processes of a workload are created once in a single array, which the jobs
+//  queue points into, and the scheduler is kept next to them instead of being leaked
+//  by its creator. Rewind returns every Process to its initial state in place, so the
+//  same workload can be simulated again without allocating (see also
+//  BasicProcessManager::Reset, which rewinds the scheduler as well).
+//  NOTE: the arena must outlive every ProcessManager simulating its jobs
+class SimulationArena {
+public:
+  //  constructors
+  SimulationArena() {}
+  explicit SimulationArena(const Workload &workload) { this->Load(workload); }
+
+  //  methods
+  Scheduler *CreateScheduler(const SchedulerConfig &);
+  void Load(const Workload &);
+  void Release();
+  void Rewind();
+
+  //  Takes ownership of a scheduler, releasing the scheduler the arena held before
+  //  First input: A pointer to a scheduler created with new
+  //  Returns the same pointer, with its own type, for the ProcessManager
+  template <typename SchedulerT>
+  SchedulerT *Adopt(SchedulerT *scheduler) {
+    this->scheduler_.reset(scheduler);
+    return scheduler;
+  }
+
+  //  Gives a scheduler of type SchedulerT for the jobs, reusing the scheduler the arena
+  //  holds when it has that type, so simulating the jobs again does not allocate
+  //  NOTE: the Processes should be rewound first, the scheduler is reset to their state
+  //  Takes no inputs
+  //  Returns the scheduler, with its own type, for the ProcessManager
+  template <typename SchedulerT>
+  SchedulerT *ReuseScheduler() {
+    SchedulerT *scheduler = dynamic_cast<SchedulerT *>(this->scheduler_.get());
+    if (scheduler == nullptr) return this->Adopt(new SchedulerT(this->jobs_));
+    scheduler->Reset(this->jobs_);
+    return scheduler;
+  }
+
+  //  getters
+  const vector<Process *> &jobs() const { return this->jobs_; }
+  Scheduler *scheduler() const { return this->scheduler_.get(); }
+  int size() const { return static_cast<int>(this->processes_.size()); }
+
+private:
+  SimulationArena(const SimulationArena &);               //  not copyable, the jobs point into it
+  SimulationArena &operator=(const SimulationArena &);    //  not copyable, the jobs point into it
+
+  vector<Process> processes_;             //  storage for every Process of the simulation
+  vector<Process *> jobs_;                //  the jobs queue, one pointer into processes_ per Process
+  std::unique_ptr<Scheduler> scheduler_;  //  the scheduler of the simulation (nullptr if none)
+};
+
+#endif  //  SIMULATION_ARENA_H_
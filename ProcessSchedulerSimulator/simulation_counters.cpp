@@ -0,0 +1,106 @@
+#include "simulation_counters.h"
+
+#include <iomanip>
+using std::endl;
+using std::setw;
+
+//  Computes the time weighted average length of the ready queue
+//  Takes no inputs
+//  Returns the average over every sampled tick, or 0 if no tick was sampled
+double SimulationCounters::AverageReadyLength() const {
+  return this->ticks > 0 ? static_cast<double>(this->ready_length_ticks) / this->ticks : 0.0;
+}
+
+//  Estimates the wall time spent inside a Scheduler method from the timed calls
+//  First input: The index of the method in SchedulerCall
+//  Returns the average nanoseconds per timed call, or 0 if no call was timed
+double SimulationCounters::CallNanoseconds(int call) const {
+  return this->timed_calls[call] > 0 ?
+    static_cast<double>(this->call_nanoseconds[call]) / this->timed_calls[call] : 0.0;
+}
+
+//  Names a Scheduler method for printing
+//  First input: The index of the method in SchedulerCall
+//  Returns the name of the method
+const char *SimulationCounters::CallName(int call) {
+  static const char *const kNames[kCallCount] = { "AddProcess", "DispatchProcess",
+    "ManageTimeQuantum", "Preemption", "QuantumRemaining", "SkipTimeQuantum" };
+  return call >= 0 && call < kCallCount ? kNames[call] : "";
+}
+
+//  Sets every counter to 0
+//  Takes no inputs
+//  Returns nothing
+void SimulationCounters::Clear() {
+  this->context_switches = 0;
+  this->preemptions = 0;
+  this->quantum_expirations = 0;
+  this->dispatches = 0;
+  this->level_dispatches.clear();
+  this->max_ready_length = 0;
+  this->ready_length_ticks = 0;
+  this->ticks = 0;
+  for (int i = 0; i < kCallCount; ++i) {
+    this->calls[i] = 0;
+    this->timed_calls[i] = 0;
+    this->call_nanoseconds[i] = 0;
+  }
+}
+
+//  Counts a dispatched Process
+//  First input: The level of the scheduler the Process was dispatched from
+//  Returns nothing
+void SimulationCounters::CountDispatch(int level) {
+  ++this->dispatches;
+  if (level < 0) level = 0;
+  if (level >= static_cast<int>(this->level_dispatches.size()))
+    this->level_dispatches.resize(level + 1, 0);
+  ++this->level_dispatches[level];
+}
+
+//  Adds the length of the ready queue during one or more ticks
+//  First input: The number of Processes in the ready queue
+//  Second input: The number of ticks the ready queue had that length
+//  Returns nothing
+void SimulationCounters::SampleReadyLength(int length, int ticks) {
+  if (length > this->max_ready_length) this->max_ready_length = length;
+  this->ready_length_ticks += static_cast<long long>(length) * ticks;
+  this->ticks += ticks;
+}
+
+//  Prints the counters as a table
+//  The total time of each Scheduler method is estimated from its timed calls
+//  First input: A reference to the stream to print to
+//  Second input: A constant reference to the counters
+//  Returns nothing
+void PrintCounters(std::ostream &out, const SimulationCounters &counters) {
+  std::ios::fmtflags flags = out.flags();
+  std::streamsize precision = out.precision();
+  out << std::fixed << std::setprecision(2);
+  out << "Context Switches:\t" << counters.context_switches << endl;
+  out << "Preemptions:\t\t" << counters.preemptions << endl;
+  out << "Quantum Expirations:\t" << counters.quantum_expirations << endl;
+  out << "Dispatches:\t\t" << counters.dispatches;
+  if (counters.level_dispatches.size() > 1) {
+    out << " (by level:";
+    for (vector<long long>::const_iterator it = counters.level_dispatches.begin();
+      it != counters.level_dispatches.end(); ++it)
+      out << " " << *it;
+    out << ")";
+  }
+  out << endl;
+  out << "Ready Queue Length:\t" << counters.AverageReadyLength() << " average, "
+    << counters.max_ready_length << " max" << endl << endl;
+
+  out << std::left << setw(20) << "Scheduler Call" << std::right << setw(14) << "Calls"
+    << setw(14) << "Total ms" << setw(14) << "ns per Call" << endl;
+  for (int i = 0; i < SimulationCounters::kCallCount; ++i) {
+    double nanoseconds = counters.CallNanoseconds(i);
+    out << std::left << setw(20) << SimulationCounters::CallName(i) << std::right
+      << setw(14) << counters.calls[i] << setw(14) << nanoseconds * counters.calls[i] / 1e6
+      << setw(14) << nanoseconds << endl;
+  }
+  out << endl;
+  out.flags(flags);
+  out.precision(precision);
+}
@@ -0,0 +1,99 @@
+#ifndef SIMULATION_COUNTERS_H_
+#define SIMULATION_COUNTERS_H_
+
+#include <chrono>
+#include <ostream>
+#include <vector>
+using std::vector;
+
+//  The counters are compiled in unless NO_SIMULATION_COUNTERS is defined
+//  (make COUNTERS=-DNO_SIMULATION_COUNTERS), in which case every counting statement
+//  disappears from the simulation and the counters stay 0
+#ifndef NO_SIMULATION_COUNTERS
+#define SIMULATION_COUNTERS
+#define COUNTERS_ONLY(statement) statement
+#else
+#define COUNTERS_ONLY(statement)
+#endif
+
+//  The calls of the Scheduler interface made during a simulation
+enum class SchedulerCall {
+  kAddProcess,
+  kDispatchProcess,
+  kManageTimeQuantum,
+  kPreemption,
+  kQuantumRemaining,
+  kSkipTimeQuantum,
+  kCount              //  the number of calls above
+};
+
+//  Counters of the work done during a simulation
+struct SimulationCounters {
+  static const int kCallCount = static_cast<int>(SchedulerCall::kCount);
+  static const int kTimingInterval = 16;    //  one in this many Scheduler calls is timed (a power of two)
+
+  long long context_switches;         //  context switches, including the first dispatch
+  long long preemptions;              //  "running" Processes preempted by a higher priority one
+  long long quantum_expirations;      //  "running" Processes returned to the ready queue by their time quantum
+  long long dispatches;               //  Processes dispatched by the scheduler
+  vector<long long> level_dispatches; //  Processes dispatched from each level of the scheduler
+  int max_ready_length;               //  the longest ready queue at the end of a tick
+  long long ready_length_ticks;       //  the ready queue length summed over every tick
+  long long ticks;                    //  the ticks summed into ready_length_ticks
+  long long calls[kCallCount];        //  the number of calls of each Scheduler method
+  long long timed_calls[kCallCount];        //  the number of calls of each Scheduler method which were timed
+  long long call_nanoseconds[kCallCount];   //  the wall time spent inside the timed calls
+
+  //  constructors
+  SimulationCounters() { this->Clear(); }
+
+  //  methods
+  double AverageReadyLength() const;
+  double CallNanoseconds(int) const;
+  static const char *CallName(int);
+  void Clear();
+  void CountDispatch(int);
+  void SampleReadyLength(int, int);
+};
+
+//  Prints the counters as a table
+void PrintCounters(std::ostream &, const SimulationCounters &);
+
+//  Makes a call of the Scheduler interface, counting it when the counters are compiled in
+//  Only one in kTimingInterval calls is timed, since reading the clock costs more than
+//  most calls
+//  First input: A pointer to the counters
+//  Second input: The Scheduler method which is called
+//  Third input: A function object which makes the call
+//  Returns the result of the call
+template <typename Function>
+inline auto CountedCall(SimulationCounters *counters, SchedulerCall call, Function function)
+  -> decltype(function()) {
+#ifdef SIMULATION_COUNTERS
+  int index = static_cast<int>(call);
+  if ((counters->calls[index]++ & (SimulationCounters::kTimingInterval - 1)) != 0)
+    return function();
+
+  //  adds the time between its construction and destruction to the counters, so that
+  //  calls returning void are timed as well
+  struct Timer {
+    Timer(SimulationCounters *counters, int call)
+      : counters_(counters), call_(call), start_(std::chrono::steady_clock::now()) {}
+    ~Timer() {
+      ++this->counters_->timed_calls[this->call_];
+      this->counters_->call_nanoseconds[this->call_] +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - this->start_).count();
+    }
+    SimulationCounters *counters_;
+    int call_;
+    std::chrono::steady_clock::time_point start_;
+  } timer(counters, index);
+#else
+  (void)counters;
+  (void)call;
+#endif
+  return function();
+}
+
+#endif  //  SIMULATION_COUNTERS_H_
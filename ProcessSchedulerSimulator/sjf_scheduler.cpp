@@ -1,21 +1,33 @@
-#include "functions.h"
 #include "sjf_scheduler.h"
 
 #include <algorithm>
-#include <iostream>
+#include <ostream>
 #include <vector>
-using std::cout;
 using std::endl;
+using std::pop_heap;
+using std::push_heap;
 using std::sort;
 using std::vector;
 
 //  A default constructor for the SJFScheduler class
-SJFScheduler::SJFScheduler() {}
+SJFScheduler::SJFScheduler() : next_sequence_(0) {}
 
 //  A constructor for the SJFScheduler class
 //  First input: A constant reference to a vector of pointers to Process objects,
-//  which represent the processes to be simulated
-SJFScheduler::SJFScheduler(const vector<Process *> &jobs) {
+//  which represent the processes to be simulated, those in the "ready" process state
+//  start in the ready queue
+SJFScheduler::SJFScheduler(const vector<Process *> &jobs) : next_sequence_(0) {
+  this->Reset(jobs);
+}
+
+//  Replaces the ready queue with the given Processes
+//  First input: A constant reference to a vector of pointers to Process objects,
+//  which are added to the ready queue in order
+//  Returns nothing
+void SJFScheduler::set_ready_queue(const vector<Process *> &jobs) {
+  this->ready_queue_.clear();
+  this->ready_queue_.reserve(jobs.size());
+
   //  For each Process in the jobs queue add it to the ready queue
   for (vector<Process *>::const_iterator it = jobs.begin(); it != jobs.end(); ++it)
     this->AddProcess(*it);
@@ -28,12 +40,11 @@ void SJFScheduler::AddProcess(Process *process) {
   //  set priority of process equal to its current burst time
   process->set_priority(process->CurrentCPUTime());
 
-  //  add to the ready queue
-  this->ready_queue_.push_back(process);
-
-  //  sort ready queue by priority using the ProcessCmp comparator
-  //  highest priority will be in the front of the queue
-  sort(this->ready_queue_.begin(), this->ready_queue_.end(), ProcessCmp);
+  //  add to the ready queue and restore the heap order in O(log n)
+  //  the Process with the highest priority will be in the front of the queue
+  ReadyEntry entry = { process->priority(), this->next_sequence_++, process };
+  this->ready_queue_.push_back(entry);
+  push_heap(this->ready_queue_.begin(), this->ready_queue_.end(), DispatchedAfter());
 }
 
 //  Dispatches the next Process in the ready queue with the highest priority
@@ -41,26 +52,36 @@ void SJFScheduler::AddProcess(Process *process) {
 //  Also sets response flag/response time for process if it is the first time
 //  entering "running" process state
 //  First input: an integer representing the current time of the process manager
-//  Returns nothing
-void SJFScheduler::DispatchProcess(int current_time) {
-  //  if the ready queue is not empty
-  if (!this->ready_queue_.empty()) {
+//  Returns a pointer to the dispatched Process
+//  Returns nullptr if the ready queue is empty
+Process *SJFScheduler::DispatchProcess(int current_time) {
+  //  if the ready queue is empty there is nothing to dispatch
+  if (this->ready_queue_.empty()) return nullptr;
 
-    //  if this is the first time the next Process has entered the "running" process state
-    if (!this->ready_queue_.front()->response_flag()) {
-      //  set response flag to true
-      this->ready_queue_.front()->set_response_flag(true);
+  Process *next = this->ready_queue_.front().process;
 
-      //  set response time to current time
-      this->ready_queue_.front()->set_response_time(current_time);
-    }
+  //  if this is the first time the next Process has entered the "running" process state
+  if (!next->response_flag()) {
+    //  set response flag to true
+    next->set_response_flag(true);
 
-    //  set the next Process to "running" process state and erase it from ready queue
-    this->ready_queue_.front()->set_state("running");
-    this->ready_queue_.erase(this->ready_queue_.begin());
+    //  set response time to the time since the Process arrived
+    next->set_response_time(current_time - next->arrival_time());
   }
+
+  //  set the next Process to "running" process state and erase it from ready queue
+  next->set_state(ProcessState::kRunning);
+  pop_heap(this->ready_queue_.begin(), this->ready_queue_.end(), DispatchedAfter());
+  this->ready_queue_.pop_back();
+  return next;
 }
 
+//  The SJF Scheduler has a single ready queue, so every Process is dispatched
+//  from level 0
+//  Takes no inputs
+//  Always returns 0
+int SJFScheduler::DispatchLevel() const { return 0; }
+
 //  The SJF Scheduler does not have a round robin queue and hence
 //  does not need to do anything when ManageTimeQuantum is called.
 //  This is only implemented, because it is required by the Scheduler
@@ -77,18 +98,33 @@ void SJFScheduler::ManageTimeQuantum(Process *running, bool &context_switch) { }
 //  Always returns false
 bool SJFScheduler::Preemption(Process *) const { return false; }
 
-//  Prints the ready queue to the console
-//  Takes no inputs
+//  The SJF Scheduler does not have a round robin queue and hence the
+//  running Process is never subject to a time quantum. This is only implemented,
+//  because it is required by the Scheduler interface
+//  First input: A pointer to a Process object which is in the "running" process state
+//  Always returns -1
+int SJFScheduler::QuantumRemaining(const Process *) const { return -1; }
+
+//  The SJF Scheduler does not have a round robin queue and hence
+//  does not need to do anything when SkipTimeQuantum is called.
+//  This is only implemented, because it is required by the Scheduler
+//  interface.
+//  First input: An integer representing the number of ticks which have elapsed
+//  Returns nothing.
+void SJFScheduler::SkipTimeQuantum(int) { }
+
+//  Prints the ready queue with processes in order by highest priority
+//  First input: A reference to the stream to print to
 //  Returns nothing
-//  Outputs the ready queue to the console with processes in order by highest priority
-void SJFScheduler::PrintQueue() const {
-  cout << "Ready Queue:\tProcess\t\tBurst" << endl;
+void SJFScheduler::PrintQueue(std::ostream &out) const {
+  out << "Ready Queue:\tProcess\t\tBurst" << endl;
   if (this->ready_queue_.begin() == this->ready_queue_.end())
-    cout << "\t\t[empty]" << endl;
+    out << "\t\t[empty]" << endl;
   else {
-    for (vector<Process *>::const_iterator it = this->ready_queue_.begin();
-      it != this->ready_queue_.end(); ++it) {
-      cout << "\t\t" << (*it)->name() << "\t\t" << (*it)->CurrentCPUTime() << endl;
+    vector<Process *> queue = this->SortedQueue();
+    for (vector<Process *>::const_iterator it = queue.begin();
+      it != queue.end(); ++it) {
+      out << "\t\t" << (*it)->name() << "\t\t" << (*it)->CurrentCPUTime() << endl;
     }
   }
 }
@@ -99,4 +135,54 @@ void SJFScheduler::PrintQueue() const {
 //  Returns false if the ready queue is not empty
 bool SJFScheduler::QueueEmpty() const {
   return this->ready_queue_.empty();
+}
+
+//  Lists the ready queue in the order in which the Processes will be dispatched
+//  The heap is copied and sorted, so this should only be used for printing
+//  Takes no inputs
+//  Returns a vector of pointers to the Processes in the ready queue with the
+//  highest priority Process first
+vector<Process *> SJFScheduler::SortedQueue() const {
+  vector<ReadyEntry> entries(this->ready_queue_);
+  sort(entries.begin(), entries.end(), [](const ReadyEntry &lhs, const ReadyEntry &rhs) {
+    return DispatchedAfter()(rhs, lhs);
+  });
+  vector<Process *> queue;
+  queue.reserve(entries.size());
+  for (vector<ReadyEntry>::const_iterator it = entries.begin(); it != entries.end(); ++it)
+    queue.push_back(it->process);
+  return queue;
+}
+
+//  Counts the Processes in the ready queue for the SJF scheduler
+//  Takes no inputs
+//  Returns the number of Processes in the ready queue
+int SJFScheduler::QueueSize() const {
+  return static_cast<int>(this->ready_queue_.size());
+}
+
+//  Replaces the ready queue with the given Processes and restarts the sequence numbers,
+//  keeping the capacity of the heap
+//  First input: A constant reference to a vector of pointers to Process objects, of
+//  which those in the "ready" process state are added to the ready queue in order
+//  Returns nothing
+void SJFScheduler::Reset(const vector<Process *> &jobs) {
+  this->next_sequence_ = 0;
+  this->ready_queue_.clear();
+  this->ready_queue_.reserve(jobs.size());
+  for (vector<Process *>::const_iterator it = jobs.begin(); it != jobs.end(); ++it)
+    if ((*it)->state() == ProcessState::kReady) this->AddProcess(*it);
+}
+
+//  Removes the Process in the last slot of the heap
+//  The last slot is a leaf, so it is never the next Process to be dispatched unless
+//  it is the only one, and removing it keeps the heap order without any sifting
+//  Takes no inputs
+//  Returns a pointer to the removed Process
+//  Returns nullptr if the ready queue is empty
+Process *SJFScheduler::StealProcess() {
+  if (this->ready_queue_.empty()) return nullptr;
+  Process *process = this->ready_queue_.back().process;
+  this->ready_queue_.pop_back();
+  return process;
 }
\ No newline at end of file
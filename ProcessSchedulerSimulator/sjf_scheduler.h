@@ -8,28 +8,59 @@
 using std::vector;
 
 //  Shortest Job First Scheduler which implements the Scheduler interface
-class SJFScheduler : public Scheduler {
+class SJFScheduler final : public Scheduler {
 public:
+  static constexpr bool kHasQuantum = false;  //  no round robin queue
+  static constexpr bool kPreemptive = false;  //  never preempts
+
+  //  An entry of the ready queue
+  //  Entries are ordered by priority (the CPU burst time) and ties are broken by
+  //  the order in which the Processes were added to the ready queue
+  struct ReadyEntry {
+    int priority;                 //  priority of the Process when it was added
+    unsigned long long sequence;  //  number of Processes added before this one
+    Process *process;             //  the Process waiting in the ready queue
+  };
+
   //  constructors
   SJFScheduler();
   SJFScheduler(const vector<Process *> &);
 
   //  methods
   void AddProcess(Process *);
-  void DispatchProcess(int);
+  int DispatchLevel() const;
+  Process *DispatchProcess(int);
   void ManageTimeQuantum(Process *, bool &);  //  this method will do nothing
   bool Preemption(Process *) const;           //  this method will always return false
-  void PrintQueue() const;
+  int QuantumRemaining(const Process *) const;  //  this method will always return -1
+  void SkipTimeQuantum(int);                      //  this method will do nothing
+  void PrintQueue(std::ostream &) const;
   bool QueueEmpty() const;
+  int QueueSize() const;
+  void Reset(const vector<Process *> &);
+  vector<Process *> SortedQueue() const;
+  Process *StealProcess();
 
   //  getters
-  const vector<Process *> &ready_queue() const { return this->ready_queue_; }
+  const vector<ReadyEntry> &ready_queue() const { return this->ready_queue_; }
 
   //  setters
-  void set_ready_queue(const vector<Process *> &ready_queue) { this->ready_queue_ = ready_queue; }
+  void set_ready_queue(const vector<Process *> &);
 private:
-  //  ready queue for the SJF Scheduler (is always sorted by priority)
-  vector<Process *> ready_queue_;
+  //  A comparator which orders the ready queue as a binary heap with the next
+  //  Process to be dispatched at the front
+  //  Returns true if the left hand side is dispatched after the right hand side
+  struct DispatchedAfter {
+    bool operator()(const ReadyEntry &lhs, const ReadyEntry &rhs) const {
+      if (lhs.priority != rhs.priority) return lhs.priority > rhs.priority;
+      return lhs.sequence > rhs.sequence;
+    }
+  };
+
+  //  ready queue for the SJF Scheduler (a binary heap, the front is always the next
+  //  Process to be dispatched)
+  vector<ReadyEntry> ready_queue_;
+  unsigned long long next_sequence_;  //  sequence number given to the next Process added
 };
 
 #endif  //  SJF_SCHEDULER_H_
\ No newline at end of file
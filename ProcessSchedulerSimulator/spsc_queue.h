@@ -0,0 +1,87 @@
+#ifndef SPSC_QUEUE_H_
+#define SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+using std::size_t;
+using std::vector;
+
+//  A bounded first in first out queue between exactly one producer thread and one
+//  consumer thread, without locks
+//  The items are stored in a ring buffer whose capacity is a power of two. The producer
+//  only writes tail_ and the consumer only writes head_, each publishing its progress
+//  with a release store which the other side reads with an acquire load, so an item is
+//  fully written before the consumer can see it. head_ and tail_ are padded onto separate
+//  cache lines, and each side caches the last value it read of the other side's index
+//  so that it only touches the shared line when the queue looks full or empty.
+template <typename T>
+class SpscQueue {
+public:
+  //  constructors
+  //  First input: The number of items the queue holds, rounded up to a power of two
+  explicit SpscQueue(size_t capacity)
+    : head_(0), cached_tail_(0), tail_(0), cached_head_(0) {
+    size_t size = 2;
+    while (size < capacity) size *= 2;
+    this->buffer_.resize(size);
+    this->mask_ = size - 1;
+  }
+
+  //  Adds an item to the back of the queue
+  //  Must only be called by the producer thread
+  //  First input: A constant reference to the item to be added
+  //  Returns true if the item was added
+  //  Returns false if the queue is full
+  bool TryPush(const T &item) {
+    size_t tail = this->tail_.load(std::memory_order_relaxed);
+    if (tail - this->cached_head_ > this->mask_) {
+      this->cached_head_ = this->head_.load(std::memory_order_acquire);
+      if (tail - this->cached_head_ > this->mask_) return false;
+    }
+    this->buffer_[tail & this->mask_] = item;
+    this->tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  //  Removes the item at the front of the queue
+  //  Must only be called by the consumer thread
+  //  First input: A pointer to the item which receives the front of the queue
+  //  Returns true if an item was removed
+  //  Returns false if the queue is empty
+  bool TryPop(T *item) {
+    size_t head = this->head_.load(std::memory_order_relaxed);
+    if (head == this->cached_tail_) {
+      this->cached_tail_ = this->tail_.load(std::memory_order_acquire);
+      if (head == this->cached_tail_) return false;
+    }
+    *item = this->buffer_[head & this->mask_];
+    this->head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  //  getters
+  size_t capacity() const { return this->mask_ + 1; }
+
+private:
+  SpscQueue(const SpscQueue &);               //  not copyable, shared between threads
+  SpscQueue &operator=(const SpscQueue &);    //  not copyable, shared between threads
+
+  static const size_t kCacheLine = 64;
+
+  vector<T> buffer_;    //  storage for the ring buffer, its size is the capacity of the queue
+  size_t mask_;         //  capacity - 1
+
+  //  consumer side, padded so that it does not share a cache line with the producer side
+  char consumer_pad_[kCacheLine];
+  std::atomic<size_t> head_;    //  number of items removed
+  size_t cached_tail_;          //  the last value of tail_ seen by the consumer
+
+  //  producer side
+  char producer_pad_[kCacheLine];
+  std::atomic<size_t> tail_;    //  number of items added
+  size_t cached_head_;          //  the last value of head_ seen by the producer
+  char end_pad_[kCacheLine];
+};
+
+#endif  //  SPSC_QUEUE_H_
@@ -0,0 +1,240 @@
+#include "srtf_scheduler.h"
+
+#include <algorithm>
+#include <ostream>
+#include <vector>
+using std::endl;
+using std::sort;
+using std::vector;
+
+const int SRTFScheduler::kNotQueued;
+
+//  A default constructor for the SRTFScheduler class
+SRTFScheduler::SRTFScheduler() : next_sequence_(0) {}
+
+//  A constructor for the SRTFScheduler class
+//  First input: A constant reference to a vector of pointers to Process objects,
+//  which represent the processes to be simulated, those in the "ready" process state
+//  start in the ready queue
+SRTFScheduler::SRTFScheduler(const vector<Process *> &jobs) : next_sequence_(0) {
+  this->Reset(jobs);
+}
+
+//  Stores an entry in a slot of the heap and records the slot of its Process
+//  First input: The slot
+//  Second input: A constant reference to the entry
+//  Returns nothing
+void SRTFScheduler::Place(size_t slot, const ReadyEntry &entry) {
+  this->ready_queue_[slot] = entry;
+  this->slot_[entry.process->id()] = static_cast<int>(slot);
+}
+
+//  Moves an entry towards the front of the heap until its parent is dispatched first
+//  First input: The slot the entry starts from, whose previous content is overwritten
+//  Second input: The entry
+//  Returns nothing
+void SRTFScheduler::SiftUp(size_t slot, ReadyEntry entry) {
+  while (slot > 0) {
+    size_t parent = (slot - 1) / 2;
+    if (!DispatchedAfter(this->ready_queue_[parent], entry)) break;
+    this->Place(slot, this->ready_queue_[parent]);
+    slot = parent;
+  }
+  this->Place(slot, entry);
+}
+
+//  Moves an entry towards the back of the heap until both children are dispatched after it
+//  First input: The slot the entry starts from, whose previous content is overwritten
+//  Second input: The entry
+//  Returns nothing
+void SRTFScheduler::SiftDown(size_t slot, ReadyEntry entry) {
+  size_t size = this->ready_queue_.size();
+  for (size_t child = 2 * slot + 1; child < size; child = 2 * slot + 1) {
+    if (child + 1 < size && DispatchedAfter(this->ready_queue_[child], this->ready_queue_[child + 1]))
+      ++child;
+    if (!DispatchedAfter(entry, this->ready_queue_[child])) break;
+    this->Place(slot, this->ready_queue_[child]);
+    slot = child;
+  }
+  this->Place(slot, entry);
+}
+
+//  Removes the entry in a slot of the heap, filling the slot with the last entry
+//  First input: The slot
+//  Returns nothing
+void SRTFScheduler::RemoveAt(size_t slot) {
+  this->slot_[this->ready_queue_[slot].process->id()] = kNotQueued;
+  ReadyEntry last = this->ready_queue_.back();
+  this->ready_queue_.pop_back();
+  if (slot == this->ready_queue_.size()) return;
+  if (slot > 0 && DispatchedAfter(this->ready_queue_[(slot - 1) / 2], last)) this->SiftUp(slot, last);
+  else this->SiftDown(slot, last);
+}
+
+//  Adds a process to the ready queue taking its remaining CPU burst into account
+//  A Process which is already in the ready queue is requeued with its current burst
+//  First input: A pointer to the Process object to be added to the ready queue
+//  Returns nothing
+void SRTFScheduler::AddProcess(Process *process) {
+  //  set priority of process equal to the remaining time of its current burst
+  process->set_priority(process->CurrentCPUTime());
+
+  int id = process->id();
+  if (id >= static_cast<int>(this->slot_.size())) this->slot_.resize(id + 1, kNotQueued);
+  ReadyEntry entry = { process->priority(), this->next_sequence_++, process };
+  int slot = this->slot_[id];
+  if (slot == kNotQueued) {
+    //  a new leaf, which can only move towards the front
+    this->ready_queue_.push_back(entry);
+    this->SiftUp(this->ready_queue_.size() - 1, entry);
+  } else if (slot > 0 && DispatchedAfter(this->ready_queue_[(slot - 1) / 2], entry)) {
+    this->SiftUp(slot, entry);
+  } else {
+    this->SiftDown(slot, entry);
+  }
+}
+
+//  Dispatches the Process in the ready queue with the shortest remaining CPU burst
+//  Changes the state of the of the dispatched process from "ready" to "running"
+//  Also sets response flag/response time for process if it is the first time
+//  entering "running" process state
+//  First input: an integer representing the current time of the process manager
+//  Returns a pointer to the dispatched Process
+//  Returns nullptr if the ready queue is empty
+Process *SRTFScheduler::DispatchProcess(int current_time) {
+  //  if the ready queue is empty there is nothing to dispatch
+  if (this->ready_queue_.empty()) return nullptr;
+
+  Process *next = this->ready_queue_.front().process;
+
+  //  if this is the first time the next Process has entered the "running" process state
+  if (!next->response_flag()) {
+    //  set response flag to true
+    next->set_response_flag(true);
+
+    //  set response time to the time since the Process arrived
+    next->set_response_time(current_time - next->arrival_time());
+  }
+
+  //  set the next Process to "running" process state and erase it from ready queue
+  next->set_state(ProcessState::kRunning);
+  this->RemoveAt(0);
+  return next;
+}
+
+//  The SRTF Scheduler has a single ready queue, so every Process is dispatched
+//  from level 0
+//  Takes no inputs
+//  Always returns 0
+int SRTFScheduler::DispatchLevel() const { return 0; }
+
+//  The SRTF Scheduler does not have a round robin queue and hence
+//  does not need to do anything when ManageTimeQuantum is called.
+//  This is only implemented, because it is required by the Scheduler
+//  interface.
+//  First input: A pointer to a Process object which is in the "running" process state
+//  Second input: A reference to a boolean value which represents the context switch flag
+//  Returns nothing.
+void SRTFScheduler::ManageTimeQuantum(Process *running, bool &context_switch) { }
+
+//  Determines if the "running" Process is preempted by the front of the ready queue
+//  The "running" Process only runs shorter as time passes and the queued Processes do
+//  not change, so a preemption can only follow AddProcess
+//  NOTE: equal remaining times do not preempt, which would only add a context switch
+//  First input: A pointer to a Process object which is in the "running" process state
+//  Returns true if a Process in the ready queue has less CPU time remaining
+//  Returns false otherwise
+bool SRTFScheduler::Preemption(Process *running) const {
+  return running != nullptr && !this->ready_queue_.empty() &&
+    this->ready_queue_.front().priority < running->CurrentCPUTime();
+}
+
+//  The SRTF Scheduler does not have a round robin queue and hence the
+//  running Process is never subject to a time quantum. This is only implemented,
+//  because it is required by the Scheduler interface
+//  First input: A pointer to a Process object which is in the "running" process state
+//  Always returns -1
+int SRTFScheduler::QuantumRemaining(const Process *) const { return -1; }
+
+//  The SRTF Scheduler does not have a round robin queue and hence
+//  does not need to do anything when SkipTimeQuantum is called.
+//  This is only implemented, because it is required by the Scheduler
+//  interface.
+//  First input: An integer representing the number of ticks which have elapsed
+//  Returns nothing.
+void SRTFScheduler::SkipTimeQuantum(int) { }
+
+//  Prints the ready queue with processes in order by highest priority
+//  First input: A reference to the stream to print to
+//  Returns nothing
+void SRTFScheduler::PrintQueue(std::ostream &out) const {
+  out << "Ready Queue:\tProcess\t\tBurst" << endl;
+  if (this->ready_queue_.empty())
+    out << "\t\t[empty]" << endl;
+  else {
+    vector<Process *> queue = this->SortedQueue();
+    for (vector<Process *>::const_iterator it = queue.begin();
+      it != queue.end(); ++it) {
+      out << "\t\t" << (*it)->name() << "\t\t" << (*it)->CurrentCPUTime() << endl;
+    }
+  }
+}
+
+//  Determines if the ready queue for the SRTF scheduler is empty
+//  Takes no inputs
+//  Returns true if the ready queue is empty
+//  Returns false if the ready queue is not empty
+bool SRTFScheduler::QueueEmpty() const {
+  return this->ready_queue_.empty();
+}
+
+//  Counts the Processes in the ready queue for the SRTF scheduler
+//  Takes no inputs
+//  Returns the number of Processes in the ready queue
+int SRTFScheduler::QueueSize() const {
+  return static_cast<int>(this->ready_queue_.size());
+}
+
+//  Replaces the ready queue with the given Processes and restarts the sequence numbers,
+//  keeping the capacity of the heap
+//  First input: A constant reference to a vector of pointers to Process objects, of
+//  which those in the "ready" process state are added to the ready queue in order
+//  Returns nothing
+void SRTFScheduler::Reset(const vector<Process *> &jobs) {
+  this->next_sequence_ = 0;
+  this->ready_queue_.clear();
+  this->ready_queue_.reserve(jobs.size());
+  this->slot_.assign(jobs.size(), kNotQueued);
+  for (vector<Process *>::const_iterator it = jobs.begin(); it != jobs.end(); ++it)
+    if ((*it)->state() == ProcessState::kReady) this->AddProcess(*it);
+}
+
+//  Lists the ready queue in the order in which the Processes will be dispatched
+//  The heap is copied and sorted, so this should only be used for printing
+//  Takes no inputs
+//  Returns a vector of pointers to the Processes in the ready queue with the
+//  highest priority Process first
+vector<Process *> SRTFScheduler::SortedQueue() const {
+  vector<ReadyEntry> entries(this->ready_queue_);
+  sort(entries.begin(), entries.end(), [](const ReadyEntry &lhs, const ReadyEntry &rhs) {
+    return DispatchedAfter(rhs, lhs);
+  });
+  vector<Process *> queue;
+  queue.reserve(entries.size());
+  for (vector<ReadyEntry>::const_iterator it = entries.begin(); it != entries.end(); ++it)
+    queue.push_back(it->process);
+  return queue;
+}
+
+//  Removes the Process in the last slot of the heap
+//  The last slot is a leaf, so it is never the next Process to be dispatched unless
+//  it is the only one, and removing it keeps the heap order without any sifting
+//  Takes no inputs
+//  Returns a pointer to the removed Process
+//  Returns nullptr if the ready queue is empty
+Process *SRTFScheduler::StealProcess() {
+  if (this->ready_queue_.empty()) return nullptr;
+  Process *process = this->ready_queue_.back().process;
+  this->RemoveAt(this->ready_queue_.size() - 1);
+  return process;
+}
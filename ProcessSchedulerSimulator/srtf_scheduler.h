@@ -0,0 +1,77 @@
+#ifndef SRTF_SCHEDULER_H_
+#define SRTF_SCHEDULER_H_
+
+#include "process.h"
+#include "scheduler.h"
+
+#include <cstddef>
+#include <vector>
+using std::size_t;
+using std::vector;
+
+//  Shortest Remaining Time First Scheduler which implements the Scheduler interface
+//  The preemptive form of SJF: a Process which enters the ready queue with a shorter
+//  CPU burst than what remains of the burst of the "running" Process preempts it
+//  The ready queue is an indexed binary heap. Every Process knows its slot in the heap
+//  through its id, so the shortest Process is compared with the "running" one in O(1)
+//  and any queued Process can be requeued with a new burst in O(log n).
+//  NOTE: the Processes are addressed by their ids, which must be distinct, as given by
+//  Workload::CreateProcess and the process managers
+class SRTFScheduler final : public Scheduler {
+public:
+  static constexpr bool kHasQuantum = false;  //  no round robin queue
+  static constexpr bool kPreemptive = true;   //  shorter arrivals preempt
+
+  //  An entry of the ready queue
+  //  Entries are ordered by priority (the remaining CPU burst time) and ties are broken
+  //  by the order in which the Processes were added to the ready queue
+  struct ReadyEntry {
+    int priority;                 //  remaining CPU burst of the Process when it was added
+    unsigned long long sequence;  //  number of Processes added before this one
+    Process *process;             //  the Process waiting in the ready queue
+  };
+
+  //  constructors
+  SRTFScheduler();
+  SRTFScheduler(const vector<Process *> &);
+
+  //  methods
+  void AddProcess(Process *);
+  int DispatchLevel() const;
+  Process *DispatchProcess(int);
+  void ManageTimeQuantum(Process *, bool &);    //  this method will do nothing
+  bool Preemption(Process *) const;
+  int QuantumRemaining(const Process *) const;  //  this method will always return -1
+  void SkipTimeQuantum(int);                    //  this method will do nothing
+  void PrintQueue(std::ostream &) const;
+  bool QueueEmpty() const;
+  int QueueSize() const;
+  void Reset(const vector<Process *> &);
+  vector<Process *> SortedQueue() const;
+  Process *StealProcess();
+
+  //  getters
+  const vector<ReadyEntry> &ready_queue() const { return this->ready_queue_; }
+
+private:
+  //  Returns true if the left hand side is dispatched after the right hand side
+  static bool DispatchedAfter(const ReadyEntry &lhs, const ReadyEntry &rhs) {
+    if (lhs.priority != rhs.priority) return lhs.priority > rhs.priority;
+    return lhs.sequence > rhs.sequence;
+  }
+
+  void Place(size_t, const ReadyEntry &);
+  void RemoveAt(size_t);
+  void SiftDown(size_t, ReadyEntry);
+  void SiftUp(size_t, ReadyEntry);
+
+  static const int kNotQueued = -1;   //  the slot of a Process which is not in the ready queue
+
+  //  ready queue for the SRTF Scheduler (a binary heap, the front is always the next
+  //  Process to be dispatched)
+  vector<ReadyEntry> ready_queue_;
+  vector<int> slot_;                  //  the slot of each Process in ready_queue_ by id, or kNotQueued
+  unsigned long long next_sequence_;  //  sequence number given to the next Process added
+};
+
+#endif  //  SRTF_SCHEDULER_H_
@@ -0,0 +1,291 @@
+#include "multicore_manager.h"
+#include "simulation_arena.h"
+#include "sweep.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+using std::endl;
+using std::setw;
+
+//  A constructor for the SweepRunner class
+//  Takes no inputs
+SweepRunner::SweepRunner() {}
+
+//  Adds a scheduler configuration to be simulated with every workload
+//  First input: A constant reference to the configuration
+//  Returns nothing
+void SweepRunner::AddScheduler(const SchedulerConfig &config) {
+  this->schedulers_.push_back(config);
+}
+
+//  Adds a workload to be simulated with every scheduler configuration
+//  First input: A constant reference to the name of the workload
+//  Second input: A pointer to the workload, which must outlive the runner and is
+//  not modified by it
+//  Returns nothing
+void SweepRunner::AddWorkload(const string &name, const Workload *workload) {
+  this->workload_names_.push_back(name);
+  this->workloads_.push_back(workload);
+}
+
+//  Simulates one workload with one scheduler configuration without printing
+//  Configurations with more than one CPU are simulated by a MultiCoreManager, others
+//  by a ProcessManager specialized for the scheduler class (SchedulerConfig::Simulate)
+//  Safe to call from several threads at once for the same workload
+//  First input: A constant reference to the workload
+//  Second input: A constant reference to the scheduler configuration
+//  Returns the summary of the simulation
+SimulationResult SweepRunner::Simulate(const Workload &workload, const SchedulerConfig &config) {
+  SummarySink sink;   //  no output at all, the result is returned instead
+  SimulationArena arena(workload);
+  const vector<Process *> &jobs = arena.jobs();
+
+  if (config.cores > 1) {
+    MultiCoreManager simulator(jobs, config);
+    simulator.set_sink(&sink);
+    simulator.SimulateScheduler();
+    return simulator.result();
+  }
+  return config.Simulate(jobs, &sink);
+}
+
+//  Runs every pairing of workload and scheduler configuration
+//  First input: The number of threads to run the simulations on, 0 selects one per core
+//  Returns the results ordered by workload and then by scheduler configuration,
+//  independent of the order in which the simulations complete
+vector<SweepResult> SweepRunner::Run(size_t threads) const {
+  size_t scheduler_count = this->schedulers_.size();
+  vector<SweepResult> results(this->workloads_.size() * scheduler_count);
+  {
+    ThreadPool pool(threads);
+    for (size_t w = 0; w < this->workloads_.size(); ++w) {
+      for (size_t s = 0; s < scheduler_count; ++s) {
+        SweepResult *slot = &results[w * scheduler_count + s];
+        slot->workload = this->workload_names_[w];
+        slot->scheduler = this->schedulers_[s].Name();
+        const Workload *workload = this->workloads_[w];
+        const SchedulerConfig *config = &this->schedulers_[s];
+        pool.Submit([slot, workload, config] {
+          slot->result = SweepRunner::Simulate(*workload, *config);
+        });
+      }
+    }
+    pool.Wait();
+  }
+  return results;
+}
+
+//  Prints the distribution of the waiting, turnaround and response times of every
+//  simulation of a sweep
+//  First input: A constant reference to the results
+//  Second input: A reference to the stream to print to
+//  Returns nothing
+void SweepRunner::PrintLatencies(const vector<SweepResult> &results, std::ostream &out) {
+  for (vector<SweepResult>::const_iterator it = results.begin(); it != results.end(); ++it) {
+    out << endl << it->workload << "  " << it->scheduler << endl;
+    PrintLatencyHeader(out);
+    PrintLatencyRow(out, "Wait", it->result.wait);
+    PrintLatencyRow(out, "Turnaround", it->result.turnaround);
+    PrintLatencyRow(out, "Response", it->result.response);
+  }
+}
+
+//  Finds the percentage of the total time of a simulation in which one CPU was busy
+//  First input: A constant reference to the result of the simulation
+//  Second input: A constant reference to the accounting of the CPU
+//  Returns the utilization of the CPU, or 0 if the simulation took no time
+static double CoreUtilization(const SimulationResult &result, const CoreStats &stats) {
+  return result.total_time > 0 ? 100.0 * stats.busy_time / result.total_time : 0.0;
+}
+
+//  Prints the results of a sweep as one table, one row per simulation, followed by the
+//  accounting of every CPU for simulations with more than one
+//  First input: A constant reference to the results
+//  Second input: A reference to the stream to print to
+//  Returns nothing
+void SweepRunner::PrintTable(const vector<SweepResult> &results, std::ostream &out) {
+  size_t workload_width = 8;
+  size_t scheduler_width = 9;
+  for (vector<SweepResult>::const_iterator it = results.begin(); it != results.end(); ++it) {
+    if (it->workload.size() > workload_width) workload_width = it->workload.size();
+    if (it->scheduler.size() > scheduler_width) scheduler_width = it->scheduler.size();
+  }
+
+  out << std::left << setw(workload_width + 2) << "Workload" << setw(scheduler_width + 2) << "Scheduler"
+    << std::right << setw(10) << "Processes" << setw(12) << "Total Time" << setw(9) << "CPU %"
+    << setw(12) << "Avg Wait" << setw(16) << "Avg Turnaround" << setw(14) << "Avg Response"
+    << endl;
+  std::ios::fmtflags flags = out.flags();
+  std::streamsize precision = out.precision();
+  out << std::fixed << std::setprecision(2);
+  for (vector<SweepResult>::const_iterator it = results.begin(); it != results.end(); ++it) {
+    const SimulationResult &result = it->result;
+    out << std::left << setw(workload_width + 2) << it->workload << setw(scheduler_width + 2) << it->scheduler
+      << std::right << setw(10) << result.process_count << setw(12) << result.total_time
+      << setw(9) << result.cpu_utilization << setw(12) << result.average_wait
+      << setw(16) << result.average_turnaround << setw(14) << result.average_response << endl;
+  }
+
+  //  the accounting of every CPU of the simulations with more than one
+  for (vector<SweepResult>::const_iterator it = results.begin(); it != results.end(); ++it) {
+    const SimulationResult &result = it->result;
+    if (result.cores.size() < 2) continue;
+    out << endl << it->workload << "  " << it->scheduler << "  Migrations " << result.migrations
+      << "  Load Imbalance " << result.load_imbalance << "  Busy Time Std Dev "
+      << result.busy_stddev << endl;
+    out << setw(5) << "CPU" << setw(12) << "Busy" << setw(12) << "Idle" << setw(12) << "Migrating"
+      << setw(9) << "CPU %" << setw(12) << "Dispatches" << setw(9) << "Steals" << endl;
+    for (vector<CoreStats>::size_type c = 0; c < result.cores.size(); ++c) {
+      const CoreStats &stats = result.cores[c];
+      out << setw(5) << c << setw(12) << stats.busy_time << setw(12) << stats.idle_time
+        << setw(12) << stats.migration_time << setw(9) << CoreUtilization(result, stats)
+        << setw(12) << stats.dispatches << setw(9) << stats.steals << endl;
+    }
+  }
+  out.flags(flags);
+  out.precision(precision);
+}
+
+//  Prints one row of a comparison table, one column per scheduler configuration
+//  First input: A reference to the stream to print to
+//  Second input: A constant reference to the label of the row
+//  Third input: An iterator to the first result of the workload
+//  Fourth input: An iterator past the last result of the workload
+//  Fifth input: The width of the label column
+//  Sixth input: The width of every other column
+//  Seventh input: A function returning the value of the row for a result
+//  Returns nothing
+template <typename ValueFunction>
+static void PrintComparisonRow(std::ostream &out, const string &label,
+  vector<SweepResult>::const_iterator first, vector<SweepResult>::const_iterator last,
+  size_t label_width, size_t width, ValueFunction value) {
+  out << std::left << setw(label_width) << label << std::right;
+  for (vector<SweepResult>::const_iterator it = first; it != last; ++it)
+    out << setw(width) << value(it->result);
+  out << endl;
+}
+
+//  Prints the results of a sweep side by side, one table per workload with one column
+//  per scheduler configuration and one row per measurement
+//  First input: A constant reference to the results, ordered by workload (see Run)
+//  Second input: A reference to the stream to print to
+//  Returns nothing
+void SweepRunner::PrintComparison(const vector<SweepResult> &results, std::ostream &out) {
+  std::ios::fmtflags flags = out.flags();
+  std::streamsize precision = out.precision();
+  out << std::fixed << std::setprecision(2);
+  vector<SweepResult>::const_iterator first = results.begin();
+  while (first != results.end()) {
+    vector<SweepResult>::const_iterator last = first;
+    size_t label_width = std::max<size_t>(16, first->workload.size() + 2);
+    size_t width = 12;
+    while (last != results.end() && last->workload == first->workload) {
+      if (last->scheduler.size() + 2 > width) width = last->scheduler.size() + 2;
+      ++last;
+    }
+
+    out << std::left << setw(label_width) << first->workload << std::right;
+    for (vector<SweepResult>::const_iterator it = first; it != last; ++it)
+      out << setw(width) << it->scheduler;
+    out << endl;
+    PrintComparisonRow(out, "Processes", first, last, label_width, width,
+      [](const SimulationResult &r) { return r.process_count; });
+    PrintComparisonRow(out, "Total Time", first, last, label_width, width,
+      [](const SimulationResult &r) { return r.total_time; });
+    PrintComparisonRow(out, "CPU %", first, last, label_width, width,
+      [](const SimulationResult &r) { return r.cpu_utilization; });
+    PrintComparisonRow(out, "Avg Wait", first, last, label_width, width,
+      [](const SimulationResult &r) { return r.average_wait; });
+    PrintComparisonRow(out, "p99 Wait", first, last, label_width, width,
+      [](const SimulationResult &r) { return r.wait.p99; });
+    PrintComparisonRow(out, "Avg Turnaround", first, last, label_width, width,
+      [](const SimulationResult &r) { return r.average_turnaround; });
+    PrintComparisonRow(out, "p99 Turnaround", first, last, label_width, width,
+      [](const SimulationResult &r) { return r.turnaround.p99; });
+    PrintComparisonRow(out, "Avg Response", first, last, label_width, width,
+      [](const SimulationResult &r) { return r.average_response; });
+    PrintComparisonRow(out, "p99 Response", first, last, label_width, width,
+      [](const SimulationResult &r) { return r.response.p99; });
+    bool multicore = false;
+    for (vector<SweepResult>::const_iterator it = first; it != last; ++it)
+      multicore = multicore || it->result.cores.size() > 1;
+    if (multicore) {
+      PrintComparisonRow(out, "Migrations", first, last, label_width, width,
+        [](const SimulationResult &r) { return r.migrations; });
+      PrintComparisonRow(out, "Load Imbalance", first, last, label_width, width,
+        [](const SimulationResult &r) { return r.load_imbalance; });
+      PrintComparisonRow(out, "Busy Std Dev", first, last, label_width, width,
+        [](const SimulationResult &r) { return r.busy_stddev; });
+    }
+    out << endl;
+    first = last;
+  }
+  out.flags(flags);
+  out.precision(precision);
+}
+
+//  Prints the columns of one latency distribution of a CSV row
+//  First input: A reference to the stream to print to
+//  Second input: A constant reference to the distribution
+//  Returns nothing
+static void PrintCsvLatency(std::ostream &out, const LatencySummary &summary) {
+  out << ',' << summary.mean << ',' << summary.p50 << ',' << summary.p90 << ','
+    << summary.p99 << ',' << summary.p999 << ',' << summary.max;
+}
+
+//  Prints the results of a sweep as comma separated values with a header line, one
+//  line per simulation, for other programs to read
+//  NOTE: names of workloads and schedulers are printed as they are, so they should not
+//  contain commas
+//  First input: A constant reference to the results
+//  Second input: A reference to the stream to print to
+//  Returns nothing
+void SweepRunner::PrintCsv(const vector<SweepResult> &results, std::ostream &out) {
+  static const char *kLatencies[] = { "wait", "turnaround", "response" };
+  static const char *kColumns[] = { "mean", "p50", "p90", "p99", "p999", "max" };
+  static const char *kCoreColumns[] = { "busy", "idle", "migrating", "utilization", "dispatches", "steals" };
+
+  //  simulations with more than one CPU add their accounting, with a group of columns
+  //  per CPU, which is left empty for CPUs a simulation does not have
+  size_t cores = 0;
+  for (vector<SweepResult>::const_iterator it = results.begin(); it != results.end(); ++it)
+    cores = std::max(cores, it->result.cores.size());
+  if (cores < 2) cores = 0;
+
+  out << "workload,scheduler,processes,total_time,idle_time,cpu_utilization";
+  for (int l = 0; l < 3; ++l)
+    for (int c = 0; c < 6; ++c) out << ',' << kLatencies[l] << '_' << kColumns[c];
+  if (cores > 0) out << ",migrations,load_imbalance,busy_stddev";
+  for (size_t core = 0; core < cores; ++core)
+    for (int c = 0; c < 6; ++c) out << ",cpu" << core << '_' << kCoreColumns[c];
+  out << endl;
+
+  std::ios::fmtflags flags = out.flags();
+  std::streamsize precision = out.precision();
+  out << std::fixed << std::setprecision(4);
+  for (vector<SweepResult>::const_iterator it = results.begin(); it != results.end(); ++it) {
+    const SimulationResult &result = it->result;
+    out << it->workload << ',' << it->scheduler << ',' << result.process_count << ','
+      << result.total_time << ',' << result.idle_time << ',' << result.cpu_utilization;
+    PrintCsvLatency(out, result.wait);
+    PrintCsvLatency(out, result.turnaround);
+    PrintCsvLatency(out, result.response);
+    if (cores > 0) {
+      out << ',' << result.migrations << ',' << result.load_imbalance << ',' << result.busy_stddev;
+      for (size_t core = 0; core < cores; ++core) {
+        if (core >= result.cores.size() || result.cores.size() < 2) {
+          out << ",,,,,,";
+          continue;
+        }
+        const CoreStats &stats = result.cores[core];
+        out << ',' << stats.busy_time << ',' << stats.idle_time << ',' << stats.migration_time
+          << ',' << CoreUtilization(result, stats) << ',' << stats.dispatches << ',' << stats.steals;
+      }
+    }
+    out << endl;
+  }
+  out.flags(flags);
+  out.precision(precision);
+}
@@ -0,0 +1,52 @@
+#ifndef SWEEP_H_
+#define SWEEP_H_
+
+#include "process.h"
+#include "process_manager.h"
+#include "scheduler_config.h"
+#include "workload.h"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+using std::size_t;
+using std::string;
+using std::vector;
+
+//  The result of simulating one workload with one scheduler configuration
+struct SweepResult {
+  string workload;            //  the name of the workload
+  string scheduler;           //  the name of the scheduler configuration
+  SimulationResult result;    //  the summary of the simulation
+};
+
+//  Runs every pairing of a set of scheduler configurations and a set of workloads
+//  as an independent simulation on a ThreadPool
+//  Each simulation creates its own Process objects and Scheduler from the shared
+//  workload, which is only read, so simulations never share mutable state
+class SweepRunner {
+public:
+  //  constructors
+  SweepRunner();
+
+  //  methods
+  void AddScheduler(const SchedulerConfig &);
+  void AddWorkload(const string &, const Workload *);
+  static void PrintComparison(const vector<SweepResult> &, std::ostream &);
+  static void PrintCsv(const vector<SweepResult> &, std::ostream &);
+  static void PrintLatencies(const vector<SweepResult> &, std::ostream &);
+  static void PrintTable(const vector<SweepResult> &, std::ostream &);
+  vector<SweepResult> Run(size_t) const;
+  static SimulationResult Simulate(const Workload &, const SchedulerConfig &);
+
+  //  getters
+  const vector<SchedulerConfig> &schedulers() const { return this->schedulers_; }
+
+private:
+  vector<SchedulerConfig> schedulers_;      //  the scheduler configurations to simulate
+  vector<string> workload_names_;           //  the name of each workload
+  vector<const Workload *> workloads_;      //  the workloads to simulate, not owned
+};
+
+#endif  //  SWEEP_H_
@@ -0,0 +1,176 @@
+#include "sweep.h"
+#include "workload.h"
+
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::string;
+
+//  Reads a comma separated list of time quanta
+//  First input: A pointer to the list, e.g. "8,16,0"
+//  Second input: A pointer to the vector the quanta are appended to
+//  Returns a pointer to the first character after the list
+static const char *ParseQuanta(const char *p, vector<int> *quanta) {
+  char *end;
+  for (long quantum = std::strtol(p, &end, 10); end != p; quantum = std::strtol(p, &end, 10)) {
+    quanta->push_back(static_cast<int>(quantum));
+    p = end;
+    if (*end != ',') break;
+    ++p;
+  }
+  return p;
+}
+
+//  Reads the whole value of an option as an integer no less than a minimum
+//  First input: A pointer to the value
+//  Second input: The smallest value accepted
+//  Third input: A pointer to the integer which is set
+//  Returns true if the value is an integer no less than the minimum
+//  Returns false otherwise, leaving the integer unchanged
+static bool ParseInt(const char *text, int minimum, int *value) {
+  char *end;
+  long parsed = std::strtol(text, &end, 10);
+  if (end == text || *end != '\0' || parsed < minimum || parsed > INT_MAX) return false;
+  *value = static_cast<int>(parsed);
+  return true;
+}
+
+//  Reads the scheduler of a -s option
+//  The scheduler is fcfs, sjf, mlfq or srtf, optionally followed by the MLFQ shape as
+//  mlfq:quantum,quantum,...[:boost_interval]
+//  First input: A constant reference to the option
+//  Second input: A pointer to the configuration, whose kind and MLFQ shape are set
+//  Returns true if the option names a scheduler
+//  Returns false otherwise
+static bool ParseScheduler(const string &option, SchedulerConfig *config) {
+  string name = option.substr(0, option.find(':'));
+  if (name == "fcfs") config->kind = SchedulerKind::kFCFS;
+  else if (name == "sjf") config->kind = SchedulerKind::kSJF;
+  else if (name == "mlfq") config->kind = SchedulerKind::kMLFQ;
+  else if (name == "srtf") config->kind = SchedulerKind::kSRTF;
+  else return false;
+  if (name.size() == option.size()) return true;
+  if (config->kind != SchedulerKind::kMLFQ) return false;
+
+  config->quanta.clear();
+  config->boost_interval = 0;
+  const char *p = ParseQuanta(option.c_str() + name.size() + 1, &config->quanta);
+  if (*p == ':') return ParseInt(p + 1, 0, &config->boost_interval);
+  return *p == '\0';
+}
+
+//  Simulates every workload given on the command line with several schedulers in
+//  parallel and prints the results, without any interaction, for use from scripts
+//  Usage: RunSweep [-j threads] [-e tick|event] [-c cpus] [-m migration_cost]
+//                  [-q quantum,quantum,...] [-b boost_interval] [-s scheduler]...
+//                  [-f table|compare|csv] workload ...
+//  -s selects a scheduler to simulate and may be repeated (see ParseScheduler), without
+//  it FCFS, SJF and MLFQ are simulated
+//  -q and -b set the shape of the MLFQ scheduler, a quantum of 0 makes a FCFS level
+//  -f selects the output: one row per simulation followed by the latency distributions
+//  (table), one column per scheduler (compare) or comma separated values (csv)
+//  By default one thread per core, the event engine, a single simulated CPU and the
+//  default MLFQ shape are used
+//  Every workload is loaded once and shared by all of its simulations
+int main(int argc, char *argv[]) {
+  int threads = 0;
+  EngineMode engine = kEventEngine;
+  int cores = 1;
+  int migration_cost = 0;
+  vector<int> quanta;
+  int boost_interval = 0;
+  vector<string> schedulers;
+  string format = "table";
+  bool usage = false;
+  int first = 1;
+  for (; first < argc && argv[first][0] == '-' && argv[first][1] != '\0'; first += 2) {
+    string option = argv[first];
+    if (option != "-j" && option != "-e" && option != "-c" && option != "-m" &&
+      option != "-b" && option != "-q" && option != "-s" && option != "-f") {
+      cerr << option << ": unknown option" << endl;
+      usage = true;
+      break;
+    }
+    if (first + 1 >= argc) {
+      cerr << option << ": missing value" << endl;
+      usage = true;
+      break;
+    }
+    const char *value = argv[first + 1];
+    bool valid = true;
+    if (option == "-j") valid = ParseInt(value, 0, &threads);
+    else if (option == "-c") valid = ParseInt(value, 1, &cores);
+    else if (option == "-m") valid = ParseInt(value, 0, &migration_cost);
+    else if (option == "-b") valid = ParseInt(value, 0, &boost_interval);
+    else if (option == "-q") valid = *ParseQuanta(value, &quanta) == '\0' && !quanta.empty();
+    else if (option == "-s") schedulers.push_back(value);
+    else if (option == "-f") format = value;
+    else if (string(value) == "tick") engine = kTickEngine;
+    else if (string(value) == "event") engine = kEventEngine;
+    else valid = false;
+    if (!valid) {
+      cerr << option << " " << value << ": invalid value" << endl;
+      usage = true;
+    }
+  }
+  if (format != "table" && format != "compare" && format != "csv") usage = true;
+  if (schedulers.empty()) {
+    schedulers.push_back("fcfs");
+    schedulers.push_back("sjf");
+    schedulers.push_back("mlfq");
+  }
+
+  //  every scheduler shares the engine and the machine, MLFQ starts from -q and -b
+  vector<SchedulerConfig> configs;
+  for (vector<string>::const_iterator it = schedulers.begin(); it != schedulers.end(); ++it) {
+    SchedulerConfig config = { SchedulerKind::kFCFS, engine, cores, migration_cost, vector<int>(), 0 };
+    if (!ParseScheduler(*it, &config)) {
+      cerr << *it << ": unknown scheduler" << endl;
+      usage = true;
+    }
+    if (config.kind == SchedulerKind::kMLFQ && it->find(':') == string::npos) {
+      config.quanta = quanta;
+      config.boost_interval = boost_interval;
+    }
+    configs.push_back(config);
+  }
+  if (first >= argc || usage) {
+    cerr << "Usage: " << argv[0]
+      << " [-j threads] [-e tick|event] [-c cpus] [-m migration_cost]"
+      << " [-q quantum,quantum,...] [-b boost_interval]"
+      << " [-s fcfs|sjf|srtf|mlfq[:quantum,...[:boost_interval]]]..."
+      << " [-f table|compare|csv] workload ..." << endl;
+    return 2;
+  }
+
+  //  every workload is loaded once and shared read only by all of its simulations
+  vector<std::unique_ptr<Workload> > workloads;
+  SweepRunner runner;
+  for (int i = first; i < argc; ++i) {
+    std::unique_ptr<Workload> workload(new Workload);
+    if (!workload->Load(argv[i])) {
+      cerr << argv[i] << ": " << workload->error() << endl;
+      return 1;
+    }
+    runner.AddWorkload(argv[i], workload.get());
+    workloads.push_back(std::move(workload));
+  }
+  for (vector<SchedulerConfig>::const_iterator it = configs.begin(); it != configs.end(); ++it)
+    runner.AddScheduler(*it);
+
+  vector<SweepResult> results = runner.Run(static_cast<size_t>(threads));
+  if (format == "compare") {
+    SweepRunner::PrintComparison(results, cout);
+  } else if (format == "csv") {
+    SweepRunner::PrintCsv(results, cout);
+  } else {
+    SweepRunner::PrintTable(results, cout);
+    SweepRunner::PrintLatencies(results, cout);
+  }
+  return 0;
+}
@@ -0,0 +1,109 @@
+#include "thread_pool.h"
+
+//  A constructor for the ThreadPool class
+//  First input: The number of worker threads, 0 selects DefaultThreadCount()
+ThreadPool::ThreadPool(size_t threads)
+  : queued_(0), outstanding_(0), next_worker_(0), stopping_(false) {
+  if (threads == 0) threads = ThreadPool::DefaultThreadCount();
+  for (size_t i = 0; i < threads; ++i) this->workers_.push_back(std::unique_ptr<Worker>(new Worker));
+  for (size_t i = 0; i < threads; ++i)
+    this->threads_.push_back(std::thread(&ThreadPool::WorkerLoop, this, i));
+}
+
+//  A destructor for the ThreadPool class
+//  Runs every task which was already submitted, then stops and joins the workers
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->stopping_ = true;
+  }
+  this->work_available_.notify_all();
+  for (vector<std::thread>::iterator it = this->threads_.begin(); it != this->threads_.end(); ++it)
+    it->join();
+}
+
+//  Determines the number of worker threads used when none is requested
+//  Takes no inputs
+//  Returns the number of hardware threads, or 1 if it cannot be determined
+size_t ThreadPool::DefaultThreadCount() {
+  unsigned int threads = std::thread::hardware_concurrency();
+  return threads == 0 ? 1 : threads;
+}
+
+//  Submits a task to be run by one of the workers
+//  Tasks are handed to the workers in turn, idle workers steal them from busy ones
+//  First input: A constant reference to the task
+//  Returns nothing
+void ThreadPool::Submit(const std::function<void()> &task) {
+  ++this->outstanding_;
+  ++this->queued_;
+  Worker &worker = *this->workers_[this->next_worker_++ % this->workers_.size()];
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.push_back(task);
+  }
+  {
+    //  taking the lock orders the notification after any worker's check of queued_
+    std::lock_guard<std::mutex> lock(this->mutex_);
+  }
+  this->work_available_.notify_one();
+}
+
+//  Blocks until every submitted task has completed
+//  Takes no inputs
+//  Returns nothing
+void ThreadPool::Wait() {
+  std::unique_lock<std::mutex> lock(this->mutex_);
+  this->work_done_.wait(lock, [this] { return this->outstanding_ == 0; });
+}
+
+//  Takes the next task for a worker, first from the back of its own deque and
+//  otherwise from the front of the deques of the other workers
+//  First input: The index of the worker
+//  Second input: A reference to the function which receives the task
+//  Returns true if a task was taken
+//  Returns false if every deque was empty
+bool ThreadPool::TakeTask(size_t index, std::function<void()> &task) {
+  size_t count = this->workers_.size();
+  for (size_t i = 0; i < count; ++i) {
+    Worker &worker = *this->workers_[(index + i) % count];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.tasks.empty()) continue;
+    if (i == 0) {
+      task.swap(worker.tasks.back());
+      worker.tasks.pop_back();
+    } else {
+      task.swap(worker.tasks.front());
+      worker.tasks.pop_front();
+    }
+    return true;
+  }
+  return false;
+}
+
+//  The body of each worker thread
+//  Runs tasks until the pool is stopping and no submitted task remains
+//  First input: The index of the worker
+//  Returns nothing
+void ThreadPool::WorkerLoop(size_t index) {
+  for (;;) {
+    std::function<void()> task;
+    if (this->TakeTask(index, task)) {
+      --this->queued_;
+      task();
+      if (--this->outstanding_ == 0) {
+        {
+          std::lock_guard<std::mutex> lock(this->mutex_);
+        }
+        this->work_done_.notify_all();
+      }
+      continue;
+    }
+
+    //  NOTE: queued_ is counted before a task is pushed, so a worker may briefly
+    //  see a task which is not yet in a deque and simply tries again
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    this->work_available_.wait(lock, [this] { return this->stopping_ || this->queued_ > 0; });
+    if (this->stopping_ && this->queued_ == 0) return;
+  }
+}
@@ -0,0 +1,56 @@
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+using std::size_t;
+using std::vector;
+
+//  A fixed size pool of worker threads which balances tasks by work stealing
+//  Every worker owns a deque of tasks: it takes its own tasks from the back and,
+//  once its deque is empty, steals from the front of the other workers' deques,
+//  so long running tasks submitted to one worker do not leave the others idle
+class ThreadPool {
+public:
+  //  constructors
+  explicit ThreadPool(size_t);
+  ~ThreadPool();
+
+  //  methods
+  static size_t DefaultThreadCount();
+  void Submit(const std::function<void()> &);
+  void Wait();
+  size_t size() const { return this->threads_.size(); }
+
+private:
+  ThreadPool(const ThreadPool &);               //  not copyable, owns threads
+  ThreadPool &operator=(const ThreadPool &);    //  not copyable, owns threads
+
+  //  The tasks submitted to one worker
+  struct Worker {
+    std::mutex mutex;                           //  guards tasks
+    std::deque<std::function<void()> > tasks;   //  tasks not yet started
+  };
+
+  bool TakeTask(size_t, std::function<void()> &);
+  void WorkerLoop(size_t);
+
+  vector<std::unique_ptr<Worker> > workers_;  //  the task deque of each worker
+  vector<std::thread> threads_;               //  the worker threads
+  std::mutex mutex_;                          //  guards the condition variables below
+  std::condition_variable work_available_;    //  signalled when a task is submitted or the pool stops
+  std::condition_variable work_done_;         //  signalled when the last outstanding task completes
+  std::atomic<size_t> queued_;                //  tasks submitted but not yet started
+  std::atomic<size_t> outstanding_;           //  tasks submitted but not yet completed
+  std::atomic<size_t> next_worker_;           //  the worker which receives the next submitted task
+  bool stopping_;                             //  set when the pool is destroyed
+};
+
+#endif  //  THREAD_POOL_H_
@@ -0,0 +1,180 @@
+#include "waiting_table.h"
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+
+//  The value of next_ for a Process whose IO burst completed in the last Tick, which
+//  is no longer filed in the wheel or the heap
+static const int kDue = -2;
+
+//  Adds a Process to the table, to complete after the remaining time of its current
+//  IO burst
+//  Does nothing if the Process is already in the table
+//  NOTE: an IO burst shorter than one tick completes in the next tick
+//  First input: A pointer to the Process which is starting an IO burst
+//  Returns nothing
+void WaitingTable::Add(Process *process) {
+  int id = process->id();
+  if (this->completion_[id] != -1) return;
+  int io = process->CurrentIOTime();
+  this->completion_[id] = this->now_ + (io > 0 ? io : 1);
+  this->processes_[id] = process;
+  ++this->count_;
+  this->Schedule(id);
+}
+
+//  Advances the clock of the table by several ticks at once
+//  The caller guarantees that no IO burst completes during the ticks
+//  First input: An integer representing the number of ticks which have elapsed
+//  Returns nothing
+void WaitingTable::Advance(int ticks) {
+  this->now_ += ticks;
+  this->Cascade();
+}
+
+//  Moves the Processes of the heap which complete less than kWheelSize ticks from now
+//  into the wheel
+//  Takes no inputs
+//  Returns nothing
+void WaitingTable::Cascade() {
+  std::greater<std::pair<int, int> > later;
+  while (!this->far_.empty() && this->far_.front().first - this->now_ < kWheelSize) {
+    int id = this->far_.front().second;
+    std::pop_heap(this->far_.begin(), this->far_.end(), later);
+    this->far_.pop_back();
+    this->Schedule(id);
+  }
+}
+
+//  Empties the table, sizes it for a jobs queue and sets its clock to 0
+//  First input: The number of Processes in the jobs queue (the ids are below it)
+//  Returns nothing
+void WaitingTable::Clear(int job_count) {
+  this->now_ = 0;
+  this->count_ = 0;
+  this->completion_.assign(job_count, -1);
+  this->next_.assign(job_count, -1);
+  this->processes_.assign(job_count, nullptr);
+  std::fill(this->slots_, this->slots_ + kWheelSize, -1);
+  std::fill(this->occupied_, this->occupied_ + kWords, 0);
+  this->far_.clear();
+}
+
+//  Makes room for Processes with larger ids, keeping every Process already waiting
+//  First input: The number of Processes in the jobs queue, at least the current number
+//  Returns nothing
+void WaitingTable::Reserve(int job_count) {
+  if (job_count <= static_cast<int>(this->completion_.size())) return;
+  this->completion_.resize(job_count, -1);
+  this->next_.resize(job_count, -1);
+  this->processes_.resize(job_count, nullptr);
+}
+
+//  Finds the IO burst which completes first
+//  Every Process in the wheel completes before every Process in the heap
+//  Takes no inputs
+//  Returns the number of ticks until it completes, or INT_MAX if no Process is waiting
+int WaitingTable::MinRemaining() const {
+  int slot = this->NextInWheel();
+  if (slot != -1) return (slot - this->now_) & kWheelMask;
+  if (!this->far_.empty()) return this->far_.front().first - this->now_;
+  return INT_MAX;
+}
+
+//  Finds the first slot of the wheel after the current time which is not empty
+//  Takes no inputs
+//  Returns the index of the slot, or -1 if the wheel is empty
+int WaitingTable::NextInWheel() const {
+  int start = (this->now_ + 1) & kWheelMask;
+  int word = start / kWordBits;
+  int bit = start % kWordBits;
+
+  //  the slots after the current time in the first word, the following words, and the
+  //  slots before the current time in the first word once the search wraps around
+  uint64_t bits = this->occupied_[word] & (~0ULL << bit);
+  for (int i = 0; i <= kWords; ++i) {
+    if (bits != 0) return word * kWordBits + __builtin_ctzll(bits);
+    word = (word + 1) % kWords;
+    bits = this->occupied_[word];
+    if (i + 1 == kWords && bit > 0) bits &= ~(~0ULL << bit);
+  }
+  return -1;
+}
+
+//  Removes a Process from the table
+//  The Processes whose IO burst completed in the last Tick are removed at once, others
+//  are unfiled from the wheel or the heap first
+//  First input: A constant pointer to the Process which is leaving the "waiting" process state
+//  Returns nothing
+void WaitingTable::Remove(const Process *process) {
+  int id = process->id();
+  if (this->completion_[id] == -1) return;
+  if (this->next_[id] != kDue) {
+    if (this->completion_[id] - this->now_ < kWheelSize) {
+      int slot = this->completion_[id] & kWheelMask;
+      int *link = &this->slots_[slot];
+      while (*link != id) link = &this->next_[*link];
+      *link = this->next_[id];
+      if (this->slots_[slot] == -1)
+        this->occupied_[slot / kWordBits] &= ~(1ULL << (slot % kWordBits));
+    } else {
+      std::pair<int, int> entry(this->completion_[id], id);
+      this->far_.erase(std::find(this->far_.begin(), this->far_.end(), entry));
+      std::make_heap(this->far_.begin(), this->far_.end(), std::greater<std::pair<int, int> >());
+    }
+  }
+  this->completion_[id] = -1;
+  this->next_[id] = -1;
+  this->processes_[id] = nullptr;
+  --this->count_;
+}
+
+//  Restarts the countdown of a Process in the table from its current IO burst, after
+//  it moved on to its next IO burst
+//  First input: A pointer to the Process
+//  Returns nothing
+void WaitingTable::Restart(Process *process) {
+  this->Remove(process);
+  this->Add(process);
+}
+
+//  Files a Process under its completion time, in the wheel or in the heap
+//  First input: The id of the Process
+//  Returns nothing
+void WaitingTable::Schedule(int id) {
+  int completion = this->completion_[id];
+  if (completion - this->now_ < kWheelSize) {
+    int slot = completion & kWheelMask;
+    this->next_[id] = this->slots_[slot];
+    this->slots_[slot] = id;
+    this->occupied_[slot / kWordBits] |= 1ULL << (slot % kWordBits);
+  } else {
+    this->far_.push_back(std::make_pair(completion, id));
+    std::push_heap(this->far_.begin(), this->far_.end(), std::greater<std::pair<int, int> >());
+  }
+}
+
+//  Advances the clock of the table by one tick and collects the Processes whose IO
+//  burst completes in that tick
+//  Only the wheel slot of the new time is visited, so the cost is proportional to the
+//  number of completions. The completed Processes stay in the table until they are
+//  removed or restarted.
+//  The Processes are appended in no particular order
+//  First input: A pointer to the vector which receives the completed Processes
+//  Returns nothing
+void WaitingTable::Tick(vector<Process *> *completed) {
+  ++this->now_;
+  this->Cascade();
+  int slot = this->now_ & kWheelMask;
+  int id = this->slots_[slot];
+  if (id == -1) return;
+  this->slots_[slot] = -1;
+  this->occupied_[slot / kWordBits] &= ~(1ULL << (slot % kWordBits));
+  while (id != -1) {
+    int next = this->next_[id];
+    this->next_[id] = kDue;
+    completed->push_back(this->processes_[id]);
+    id = next;
+  }
+}
@@ -0,0 +1,64 @@
+#ifndef WAITING_TABLE_H_
+#define WAITING_TABLE_H_
+
+#include "process.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+using std::vector;
+
+//  The Processes in the "waiting" process state, scheduled by the time their IO burst
+//  completes
+//  The table keeps its own clock, which Tick and Advance move along with the clock of
+//  the simulation. A Process is filed under the absolute time its IO burst completes:
+//  in a timing wheel of kWheelSize one tick slots when that is less than kWheelSize
+//  ticks away, otherwise in a min-heap whose entries move into the wheel as the clock
+//  approaches them. A tick therefore only touches the Processes which complete in it,
+//  and finding the next completion does not depend on the number of waiting Processes.
+//  NOTE: the remaining IO time of a waiting Process is only kept by the table (see
+//  remaining), CurrentIOTime always gives the length of the whole burst
+class WaitingTable {
+public:
+  static const int kWheelBits = 8;                  //  log2 of kWheelSize
+  static const int kWheelSize = 1 << kWheelBits;    //  the ticks covered by the timing wheel
+
+  //  constructors
+  WaitingTable() : now_(0), count_(0) { this->Clear(0); }
+
+  //  methods
+  void Add(Process *);
+  void Advance(int);
+  void Clear(int);
+  int MinRemaining() const;
+  void Remove(const Process *);
+  void Reserve(int);
+  void Restart(Process *);
+  void Tick(vector<Process *> *);
+
+  //  getters
+  bool contains(const Process *process) const { return this->completion_[process->id()] != -1; }
+  bool empty() const { return this->count_ == 0; }
+  int remaining(const Process *process) const { return this->completion_[process->id()] - this->now_; }
+  int size() const { return this->count_; }
+
+private:
+  static const int kWheelMask = kWheelSize - 1;
+  static const int kWordBits = 64;
+  static const int kWords = kWheelSize / kWordBits;
+
+  void Cascade();
+  int NextInWheel() const;
+  void Schedule(int);
+
+  int now_;                         //  the current time of the table
+  int count_;                       //  the number of Processes in the table
+  vector<int> completion_;          //  the time the IO burst of each Process completes by Process id (-1 if not waiting)
+  vector<int> next_;                //  the next Process in the same wheel slot by Process id (-1 at the end)
+  vector<Process *> processes_;     //  the Processes by Process id
+  int slots_[kWheelSize];           //  the first Process of each wheel slot (-1 if empty)
+  uint64_t occupied_[kWords];       //  a bit for each wheel slot which is not empty
+  vector<std::pair<int, int> > far_;  //  min-heap of (completion time, Process id) at least kWheelSize ticks away
+};
+
+#endif  //  WAITING_TABLE_H_
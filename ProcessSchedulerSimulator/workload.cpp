@@ -0,0 +1,525 @@
+#include "workload.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+using std::string;
+using std::ostringstream;
+using std::vector;
+
+//  Size of the chunks in which text workload files are read
+static const size_t kReadChunkSize = 1 << 20;
+
+//  Identifies binary workload files
+static const char kWorkloadMagic[8] = { 'P', 'S', 'S', 'W', 'K', 'L', 'D', '\0' };
+
+//  The version of the binary workload layout written by SaveBinaryFile
+static const uint32_t kWorkloadVersion = 1;
+
+//  The byte order marker written to binary workload files
+static const uint32_t kWorkloadByteOrder = 0x01020304;
+
+static_assert(sizeof(int) == sizeof(int32_t), "bursts are stored as 32 bit integers");
+static_assert(sizeof(WorkloadFileHeader) == 40, "the header layout is part of the file format");
+static_assert(sizeof(WorkloadEntry) == 32, "the process table layout is part of the file format");
+
+//  Skips spaces and tabs
+//  First input: A pointer to the first character to be examined
+//  Second input: A pointer one past the last character of the line
+//  Returns a pointer to the first character which is not a space or tab
+static const char *SkipBlanks(const char *it, const char *end) {
+  while (it != end && (*it == ' ' || *it == '\t')) ++it;
+  return it;
+}
+
+//  Parses a non-negative decimal integer without allocating
+//  First input: A reference to a pointer to the first digit, which is advanced past the digits
+//  Second input: A pointer one past the last character of the line
+//  Third input: A reference to an integer which receives the parsed value
+//  Returns true if at least one digit was parsed and the value fits in an int
+//  Returns false otherwise
+static bool ParseInt(const char *&it, const char *end, int &value) {
+  const char *start = it;
+  long long result = 0;
+  while (it != end && *it >= '0' && *it <= '9') {
+    result = result * 10 + (*it - '0');
+    if (result > INT_MAX) return false;
+    ++it;
+  }
+  value = static_cast<int>(result);
+  return it != start && (it == end || *it == ' ' || *it == '\t');
+}
+
+//  A default constructor for the Workload class
+//  Creates an empty workload
+Workload::Workload() : mapping_(nullptr), mapping_size_(0) {
+  this->Clear();
+}
+
+//  A destructor for the Workload class
+//  Unmaps the binary workload file if one is mapped
+Workload::~Workload() {
+  this->Unmap();
+}
+
+//  Removes every process from the workload
+//  Takes no inputs
+//  Returns nothing
+void Workload::Clear() {
+  this->Unmap();
+  this->owned_entries_.clear();
+  this->owned_bursts_.clear();
+  this->owned_names_.clear();
+  this->error_.clear();
+  this->UseOwnedStorage();
+}
+
+//  Points the process table, burst array and name table at the owned storage
+//  Must be called whenever the owned storage may have been reallocated
+//  Takes no inputs
+//  Returns nothing
+void Workload::UseOwnedStorage() {
+  this->entries_ = this->owned_entries_.data();
+  this->bursts_ = this->owned_bursts_.data();
+  this->names_ = this->owned_names_.data();
+  this->size_ = this->owned_entries_.size();
+}
+
+//  Unmaps the binary workload file if one is mapped
+//  Takes no inputs
+//  Returns nothing
+void Workload::Unmap() {
+  if (this->mapping_ != nullptr) munmap(this->mapping_, this->mapping_size_);
+  this->mapping_ = nullptr;
+  this->mapping_size_ = 0;
+}
+
+//  Copies a mapped binary workload into owned storage so that processes may be
+//  added to it
+//  Takes no inputs
+//  Returns nothing
+void Workload::Detach() {
+  if (this->mapping_ == nullptr) return;
+  size_t burst_count = 0;
+  size_t name_bytes = 0;
+  for (size_t i = 0; i < this->size_; ++i) {
+    const WorkloadEntry &entry = this->entries_[i];
+    if (entry.burst_offset + entry.cpu_count + entry.io_count > burst_count)
+      burst_count = entry.burst_offset + entry.cpu_count + entry.io_count;
+    if (entry.name_offset + entry.name_length > name_bytes)
+      name_bytes = entry.name_offset + entry.name_length;
+  }
+  this->owned_entries_.assign(this->entries_, this->entries_ + this->size_);
+  this->owned_bursts_.assign(this->bursts_, this->bursts_ + burst_count);
+  this->owned_names_.assign(this->names_, this->names_ + name_bytes);
+  this->Unmap();
+  this->UseOwnedStorage();
+}
+
+//  Adds a process to the workload
+//  First input: A constant reference to a string representing the name of the process
+//  Second input: An integer representing the time at which the process arrives
+//  Third input: A constant reference to a vector of ints representing the CPU bursts in order to be executed
+//  Fourth input: A constant reference to a vector of ints representing the IO bursts in order to be executed
+//  Returns nothing
+void Workload::AddProcess(const string &name, int arrival_time,
+  const vector<int> &cpus, const vector<int> &ios) {
+  this->Detach();
+  WorkloadEntry entry;
+  entry.burst_offset = this->owned_bursts_.size();
+  entry.cpu_count = static_cast<uint32_t>(cpus.size());
+  entry.io_count = static_cast<uint32_t>(ios.size());
+  entry.name_offset = this->owned_names_.size();
+  entry.name_length = static_cast<uint32_t>(name.size());
+  entry.arrival_time = arrival_time;
+  this->owned_entries_.push_back(entry);
+  this->owned_bursts_.insert(this->owned_bursts_.end(), cpus.begin(), cpus.end());
+  this->owned_bursts_.insert(this->owned_bursts_.end(), ios.begin(), ios.end());
+  this->owned_names_.insert(this->owned_names_.end(), name.begin(), name.end());
+  this->UseOwnedStorage();
+}
+
+//  Adds the process of one line in the format of a text workload file to the workload
+//  Used to read text workloads one line at a time, e.g. by a WorkloadStream
+//  First input: A pointer to the first character of the line
+//  Second input: A pointer one past the last character of the line (excluding the newline)
+//  Third input: The line number, used in error messages
+//  Returns true if the line is blank, a comment, or a valid process
+//  Returns false if the line is malformed, error() describes the problem
+bool Workload::AddTextLine(const char *line, const char *end, size_t line_number) {
+  this->Detach();
+  bool ok = this->ParseLine(line, end, line_number);
+  this->UseOwnedStorage();
+  return ok;
+}
+
+//  Reserves storage so that processes can be added without regrowing the arrays
+//  First input: The number of processes which will be added
+//  Second input: The total number of CPU and IO bursts which will be added
+//  Returns nothing
+void Workload::Reserve(size_t processes, size_t bursts) {
+  this->Detach();
+  this->owned_entries_.reserve(this->owned_entries_.size() + processes);
+  this->owned_bursts_.reserve(this->owned_bursts_.size() + bursts);
+  this->UseOwnedStorage();
+}
+
+//  Adds a process parsed from a workload file to the workload
+//  First input: A pointer to the characters of the name of the process
+//  Second input: The number of characters in the name
+//  Third input: An integer representing the time at which the process arrives
+//  Fourth input: A constant reference to a vector of ints representing the bursts of the
+//  process in order, alternating between CPU bursts and IO bursts
+//  Returns nothing
+void Workload::AddParsedProcess(const char *name, size_t length, int arrival_time,
+  const vector<int> &bursts) {
+  WorkloadEntry entry;
+  entry.burst_offset = this->owned_bursts_.size();
+  entry.cpu_count = static_cast<uint32_t>((bursts.size() + 1) / 2);
+  entry.io_count = static_cast<uint32_t>(bursts.size() / 2);
+  entry.name_offset = this->owned_names_.size();
+  entry.name_length = static_cast<uint32_t>(length);
+  entry.arrival_time = arrival_time;
+  this->owned_entries_.push_back(entry);
+  for (size_t i = 0; i < bursts.size(); i += 2) this->owned_bursts_.push_back(bursts[i]);
+  for (size_t i = 1; i < bursts.size(); i += 2) this->owned_bursts_.push_back(bursts[i]);
+  this->owned_names_.insert(this->owned_names_.end(), name, name + length);
+}
+
+//  Creates a Process for a process of the workload, in the "ready" process state or,
+//  if it arrives after time 0, the "new" process state
+//  The Process views the bursts and the name of the workload without copying them, so
+//  the workload must outlive it. Its id is its index in the workload.
+//  First input: The index of the process in the workload
+//  Returns the Process
+Process Workload::CreateProcess(size_t i) const {
+  Process process(BurstList(this->cpu_bursts(i), this->cpu_count(i)),
+    BurstList(this->io_bursts(i), this->io_count(i)),
+    this->name_data(i), this->name_length(i), ProcessState::kReady);
+  process.set_id(static_cast<int>(i));
+  process.set_arrival_time(this->arrival_time(i));
+  process.Reset();
+  return process;
+}
+
+//  Creates a Process for every process of the workload (see CreateProcess)
+//  The Processes view the bursts and names of the workload without copying them, so
+//  the workload must outlive them
+//  Takes no inputs
+//  Returns a vector of Process objects in the order in which they were added
+vector<Process> Workload::CreateProcesses() const {
+  vector<Process> processes;
+  processes.reserve(this->size());
+  for (size_t i = 0; i < this->size(); ++i) processes.push_back(this->CreateProcess(i));
+  return processes;
+}
+
+//  Returns the name of a process
+//  First input: The index of the process in the workload
+//  Returns a string holding the name of the process
+string Workload::Name(size_t i) const {
+  return string(this->names_ + this->entries_[i].name_offset, this->entries_[i].name_length);
+}
+
+//  Replaces the workload with the processes of a workload file
+//  Binary workload files are recognized by their header, any other file is parsed as text
+//  First input: A constant reference to a string holding the path of the file
+//  Returns true if the whole file was loaded
+//  Returns false if the file could not be read or is malformed, error() describes the problem
+bool Workload::Load(const string &path) {
+  char magic[sizeof(kWorkloadMagic)] = { 0 };
+  FILE *file = fopen(path.c_str(), "rb");
+  if (file != nullptr) {
+    size_t read = fread(magic, 1, sizeof(magic), file);
+    fclose(file);
+    if (read == sizeof(magic) && memcmp(magic, kWorkloadMagic, sizeof(magic)) == 0)
+      return this->LoadBinaryFile(path);
+  }
+  return this->LoadTextFile(path);
+}
+
+//  Replaces the workload with the processes of a binary workload file
+//  The file is memory mapped and its process table, burst array and name table are
+//  used in place, so loading costs no copies regardless of the size of the file
+//  First input: A constant reference to a string holding the path of the file
+//  Returns true if the file was mapped and its process table is consistent
+//  Returns false if the file could not be mapped or is malformed, error() describes the problem
+bool Workload::LoadBinaryFile(const string &path) {
+  this->Clear();
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    this->error_ = "could not open " + path;
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(WorkloadFileHeader)) {
+    close(fd);
+    this->error_ = "not a binary workload file";
+    return false;
+  }
+  size_t file_size = static_cast<size_t>(info.st_size);
+  void *mapping = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    this->error_ = "could not map " + path;
+    return false;
+  }
+  this->mapping_ = mapping;
+  this->mapping_size_ = file_size;
+
+  //  check the header against the size of the file
+  const char *base = static_cast<const char *>(mapping);
+  const WorkloadFileHeader *header = reinterpret_cast<const WorkloadFileHeader *>(base);
+  size_t table_bytes = header->process_count * sizeof(WorkloadEntry);
+  size_t burst_bytes = header->burst_count * sizeof(int32_t);
+  bool ok = memcmp(header->magic, kWorkloadMagic, sizeof(kWorkloadMagic)) == 0 &&
+    header->version == kWorkloadVersion && header->byte_order == kWorkloadByteOrder &&
+    header->process_count <= file_size / sizeof(WorkloadEntry) &&
+    header->burst_count <= file_size / sizeof(int32_t) && header->name_bytes <= file_size &&
+    sizeof(WorkloadFileHeader) + table_bytes + burst_bytes + header->name_bytes <= file_size;
+  if (!ok) {
+    this->Unmap();
+    this->UseOwnedStorage();
+    this->error_ = "unsupported or truncated binary workload file";
+    return false;
+  }
+
+  //  check that every entry of the process table stays inside the arrays and, like a
+  //  line of a text workload, has at least one CPU burst, one IO burst between each pair
+  //  of CPU bursts and only positive bursts
+  const WorkloadEntry *entries =
+    reinterpret_cast<const WorkloadEntry *>(base + sizeof(WorkloadFileHeader));
+  const int32_t *bursts =
+    reinterpret_cast<const int32_t *>(base + sizeof(WorkloadFileHeader) + table_bytes);
+  for (size_t i = 0; i < header->process_count; ++i) {
+    ostringstream message;
+    if (entries[i].burst_offset > header->burst_count ||
+      entries[i].burst_offset + entries[i].cpu_count + entries[i].io_count > header->burst_count ||
+      entries[i].name_offset > header->name_bytes ||
+      entries[i].name_offset + entries[i].name_length > header->name_bytes) {
+      message << "process " << i << " lies outside the burst array or name table";
+    } else if (entries[i].cpu_count == 0 || entries[i].io_count != entries[i].cpu_count - 1) {
+      message << "process " << i << " needs at least one CPU burst and one IO burst "
+        << "between each pair of CPU bursts";
+    } else {
+      const int32_t *first = bursts + entries[i].burst_offset;
+      const int32_t *last = first + entries[i].cpu_count + entries[i].io_count;
+      if (std::find_if(first, last, [](int32_t burst) { return burst <= 0; }) != last)
+        message << "process " << i << " has a burst which is not positive";
+    }
+    if (!message.str().empty()) {
+      this->Unmap();
+      this->UseOwnedStorage();
+      this->error_ = message.str();
+      return false;
+    }
+  }
+
+  this->entries_ = entries;
+  this->bursts_ = bursts;
+  this->names_ = base + sizeof(WorkloadFileHeader) + table_bytes + burst_bytes;
+  this->size_ = header->process_count;
+  return true;
+}
+
+//  Writes the workload as a binary workload file
+//  First input: A constant reference to a string holding the path of the file
+//  Returns true if the whole file was written
+//  Returns false if the file could not be written, error() describes the problem
+bool Workload::SaveBinaryFile(const string &path) {
+  //  a mapped workload is copied into owned storage first, which knows the exact
+  //  length of each array
+  this->Detach();
+  WorkloadFileHeader header;
+  memcpy(header.magic, kWorkloadMagic, sizeof(kWorkloadMagic));
+  header.version = kWorkloadVersion;
+  header.byte_order = kWorkloadByteOrder;
+  header.process_count = this->owned_entries_.size();
+  header.burst_count = this->owned_bursts_.size();
+  header.name_bytes = this->owned_names_.size();
+
+  FILE *file = fopen(path.c_str(), "wb");
+  if (file == nullptr) {
+    this->error_ = "could not create " + path;
+    return false;
+  }
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+    fwrite(this->owned_entries_.data(), sizeof(WorkloadEntry), this->owned_entries_.size(), file) ==
+      this->owned_entries_.size() &&
+    fwrite(this->owned_bursts_.data(), sizeof(int32_t), this->owned_bursts_.size(), file) ==
+      this->owned_bursts_.size() &&
+    fwrite(this->owned_names_.data(), 1, this->owned_names_.size(), file) ==
+      this->owned_names_.size();
+  ok = fclose(file) == 0 && ok;
+  if (!ok) this->error_ = "could not write " + path;
+  return ok;
+}
+
+//  Replaces the workload with the processes of a text workload file
+//  The file is read in large chunks and parsed in place, so no memory is allocated
+//  per line or per token apart from the growth of the workload's own arrays
+//  First input: A constant reference to a string holding the path of the file
+//  Returns true if the whole file was loaded
+//  Returns false if the file could not be read or is malformed, error() describes the problem
+bool Workload::LoadTextFile(const string &path) {
+  this->Clear();
+  FILE *file = fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    this->error_ = "could not open " + path;
+    return false;
+  }
+
+  //  reserve room for the bursts assuming about three characters per burst, which
+  //  avoids regrowing the burst arrays while loading large files
+  if (fseek(file, 0, SEEK_END) == 0) {
+    long file_size = ftell(file);
+    if (file_size > 0) this->owned_bursts_.reserve(file_size / 3);
+    rewind(file);
+  }
+
+  vector<char> buffer(kReadChunkSize);
+  vector<char> carry;   //  the start of a line which continues in the next chunk
+  size_t line_number = 0;
+  bool ok = true;
+  size_t read;
+  while (ok && (read = fread(buffer.data(), 1, buffer.size(), file)) > 0) {
+    const char *line = buffer.data();
+    const char *end = line + read;
+
+    //  parse every complete line in the chunk
+    const char *newline;
+    while (ok && (newline = static_cast<const char *>(memchr(line, '\n', end - line))) != nullptr) {
+      ++line_number;
+      if (carry.empty()) {
+        ok = this->ParseLine(line, newline, line_number);
+      } else {
+        carry.insert(carry.end(), line, newline);
+        ok = this->ParseLine(carry.data(), carry.data() + carry.size(), line_number);
+        carry.clear();
+      }
+      line = newline + 1;
+    }
+
+    //  keep the unterminated end of the chunk for the next chunk
+    carry.insert(carry.end(), line, end);
+  }
+
+  if (ok && ferror(file)) {
+    this->error_ = "could not read " + path;
+    ok = false;
+  }
+  if (ok && !carry.empty())
+    ok = this->ParseLine(carry.data(), carry.data() + carry.size(), line_number + 1);
+  fclose(file);
+  this->UseOwnedStorage();
+  return ok;
+}
+
+//  Appends the decimal digits of a non-negative integer to a character buffer
+//  First input: A reference to the vector of characters to append to
+//  Second input: The integer to be written
+//  Returns nothing
+static void AppendInt(vector<char> &out, long long value) {
+  char digits[20];
+  int count = 0;
+  do {
+    digits[count++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value > 0);
+  while (count > 0) out.push_back(digits[--count]);
+}
+
+//  Writes the workload as a text workload file
+//  Lines are formatted into a buffer which is written in large chunks
+//  First input: A constant reference to a string holding the path of the file
+//  Returns true if the whole file was written
+//  Returns false if the file could not be written, error() describes the problem
+bool Workload::SaveTextFile(const string &path) {
+  FILE *file = fopen(path.c_str(), "wb");
+  if (file == nullptr) {
+    this->error_ = "could not create " + path;
+    return false;
+  }
+  static const char kHeader[] = "# name arrival_time cpu_burst io_burst ... cpu_burst\n";
+  bool ok = fwrite(kHeader, 1, sizeof(kHeader) - 1, file) == sizeof(kHeader) - 1;
+  vector<char> buffer;
+  buffer.reserve(kReadChunkSize + 4096);
+  for (size_t i = 0; ok && i < this->size_; ++i) {
+    const WorkloadEntry &entry = this->entries_[i];
+    buffer.insert(buffer.end(), this->names_ + entry.name_offset,
+      this->names_ + entry.name_offset + entry.name_length);
+    buffer.push_back(' ');
+    AppendInt(buffer, entry.arrival_time);
+
+    //  interleave the CPU and IO bursts starting with a CPU burst
+    const int *cpus = this->cpu_bursts(i);
+    const int *ios = this->io_bursts(i);
+    for (uint32_t j = 0; j < entry.cpu_count || j < entry.io_count; ++j) {
+      if (j < entry.cpu_count) {
+        buffer.push_back(' ');
+        AppendInt(buffer, cpus[j]);
+      }
+      if (j < entry.io_count) {
+        buffer.push_back(' ');
+        AppendInt(buffer, ios[j]);
+      }
+    }
+    buffer.push_back('\n');
+
+    if (buffer.size() >= kReadChunkSize) {
+      ok = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+      buffer.clear();
+    }
+  }
+  if (ok && !buffer.empty()) ok = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+  ok = fclose(file) == 0 && ok;
+  if (!ok) this->error_ = "could not write " + path;
+  return ok;
+}
+
+//  Parses one line of a text workload file and adds its process to the workload
+//  First input: A pointer to the first character of the line
+//  Second input: A pointer one past the last character of the line (excluding the newline)
+//  Third input: The line number, used in error messages
+//  Returns true if the line is blank, a comment, or a valid process
+//  Returns false if the line is malformed, error() describes the problem
+bool Workload::ParseLine(const char *it, const char *end, size_t line_number) {
+  if (it != end && end[-1] == '\r') --end;
+  it = SkipBlanks(it, end);
+  if (it == end || *it == '#') return true;
+
+  //  the name is everything up to the next blank
+  const char *name = it;
+  while (it != end && *it != ' ' && *it != '\t') ++it;
+  size_t name_length = it - name;
+
+  //  the arrival time and the bursts are integers
+  int arrival_time = 0;
+  it = SkipBlanks(it, end);
+  bool ok = ParseInt(it, end, arrival_time);
+  this->line_bursts_.clear();
+  for (it = SkipBlanks(it, end); ok && it != end; it = SkipBlanks(it, end)) {
+    int burst = 0;
+    ok = ParseInt(it, end, burst) && burst > 0;
+    this->line_bursts_.push_back(burst);
+  }
+
+  if (!ok || this->line_bursts_.empty()) {
+    ostringstream message;
+    message << "line " << line_number << ": expected a name, an arrival time and "
+      << "at least one positive CPU burst";
+    this->error_ = message.str();
+    return false;
+  }
+  this->AddParsedProcess(name, name_length, arrival_time, this->line_bursts_);
+  return true;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#ifndef WORKLOAD_H_
+#define WORKLOAD_H_
+
+#include "process.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+using std::size_t;
+using std::string;
+using std::vector;
+
+//  An entry of the process table of a workload
+//  The bursts of a process are stored back to back in the burst array of the
+//  workload: first all of its CPU bursts, then all of its IO bursts
+struct WorkloadEntry {
+  uint64_t burst_offset;    //  index in the burst array of the first CPU burst
+  uint32_t cpu_count;       //  number of CPU bursts
+  uint32_t io_count;        //  number of IO bursts
+  uint64_t name_offset;     //  index in the name table of the first character of the name
+  uint32_t name_length;     //  number of characters in the name
+  int32_t arrival_time;     //  time at which the process arrives
+};
+
+//  The fixed size header at the start of a binary workload file
+//  A binary workload file is laid out as:
+//    the header, the process table (process_count entries), the burst array
+//    (burst_count 32 bit integers) and the name table (name_bytes characters)
+//  All values are stored in the byte order of the machine which wrote the file,
+//  which is recorded in byte_order so that foreign files are rejected
+struct WorkloadFileHeader {
+  char magic[8];            //  identifies the file as a binary workload ("PSSWKLD")
+  uint32_t version;         //  version of the layout, currently 1
+  uint32_t byte_order;      //  0x01020304 as written by the machine which created the file
+  uint64_t process_count;   //  number of entries in the process table
+  uint64_t burst_count;     //  number of integers in the burst array
+  uint64_t name_bytes;      //  number of characters in the name table
+};
+
+//  A set of processes to be simulated, stored in a process table, one contiguous
+//  burst array and one name table rather than in one allocation per process
+//
+//  Text workload files have one process per line:
+//    name arrival_time cpu_burst io_burst cpu_burst io_burst ... cpu_burst
+//  Fields are separated by spaces or tabs, bursts alternate starting with a CPU
+//  burst, and blank lines and lines starting with '#' are ignored
+//
+//  Binary workload files (see WorkloadFileHeader) are memory mapped and their
+//  arrays are used in place without being copied
+//
+//  Once loaded a workload is only read: the Processes created from it view its bursts
+//  and names, so any number of simulations may share one copy of it, from any number
+//  of threads, as long as it is not modified or destroyed while they run
+class Workload {
+public:
+  //  constructors
+  Workload();
+  ~Workload();
+
+  //  methods
+  void AddProcess(const string &, int, const vector<int> &, const vector<int> &);
+  bool AddTextLine(const char *, const char *, size_t);
+  void Clear();
+  Process CreateProcess(size_t) const;
+  vector<Process> CreateProcesses() const;
+  bool Load(const string &);
+  bool LoadBinaryFile(const string &);
+  bool LoadTextFile(const string &);
+  string Name(size_t) const;
+  void Reserve(size_t, size_t);
+  bool SaveBinaryFile(const string &);
+  bool SaveTextFile(const string &);
+  size_t size() const { return this->size_; }
+
+  //  getters
+  int arrival_time(size_t i) const { return this->entries_[i].arrival_time; }
+  const int *cpu_bursts(size_t i) const { return this->bursts_ + this->entries_[i].burst_offset; }
+  int cpu_count(size_t i) const { return this->entries_[i].cpu_count; }
+  const string &error() const { return this->error_; }
+  const int *io_bursts(size_t i) const { return this->cpu_bursts(i) + this->entries_[i].cpu_count; }
+  int io_count(size_t i) const { return this->entries_[i].io_count; }
+  bool mapped() const { return this->mapping_ != nullptr; }
+  const char *name_data(size_t i) const { return this->names_ + this->entries_[i].name_offset; }
+  int name_length(size_t i) const { return this->entries_[i].name_length; }
+
+private:
+  Workload(const Workload &);               //  not copyable, may own a mapping
+  Workload &operator=(const Workload &);    //  not copyable, may own a mapping
+
+  void AddParsedProcess(const char *, size_t, int, const vector<int> &);
+  void Detach();
+  bool ParseLine(const char *, const char *, size_t);
+  void Unmap();
+  void UseOwnedStorage();
+
+  const WorkloadEntry *entries_;        //  the process table in use (owned or mapped)
+  const int *bursts_;                   //  the burst array in use (owned or mapped)
+  const char *names_;                   //  the name table in use (owned or mapped)
+  size_t size_;                         //  number of processes in the workload
+  vector<WorkloadEntry> owned_entries_; //  storage for the process table of a text or built workload
+  vector<int> owned_bursts_;            //  storage for the burst array of a text or built workload
+  vector<char> owned_names_;            //  storage for the name table of a text or built workload
+  void *mapping_;                       //  start of the mapped binary file (nullptr if not mapped)
+  size_t mapping_size_;                 //  length of the mapped binary file
+  vector<int> line_bursts_;             //  scratch space for the bursts of the line being parsed
+  string error_;                        //  description of the last load failure
+};
+
+#endif  //  WORKLOAD_H_
\ No newline at end of file
@@ -0,0 +1,27 @@
+#include "workload.h"
+
+#include <iostream>
+using std::cerr;
+using std::cout;
+using std::endl;
+
+//  Converts a text workload file into a binary workload file
+//  Usage: ConvertWorkload input.txt output.bin
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    cerr << "Usage: " << argv[0] << " input.txt output.bin" << endl;
+    return 2;
+  }
+
+  Workload workload;
+  if (!workload.LoadTextFile(argv[1])) {
+    cerr << argv[1] << ": " << workload.error() << endl;
+    return 1;
+  }
+  if (!workload.SaveBinaryFile(argv[2])) {
+    cerr << argv[2] << ": " << workload.error() << endl;
+    return 1;
+  }
+  cout << "Converted " << workload.size() << " processes" << endl;
+  return 0;
+}
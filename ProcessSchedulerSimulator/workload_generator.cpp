@@ -0,0 +1,209 @@
+#include "workload_generator.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+using std::string;
+using std::to_string;
+using std::vector;
+
+//  The longest burst a generated process may have, heavy tailed distributions
+//  are truncated here so that bursts fit in an int with room to spare
+static const double kMaxBurst = 1e9;
+
+//  The largest number of CPU bursts a generated process may have
+static const double kMaxBurstCount = 1e6;
+
+//  Advances a splitmix64 state and returns its next output
+//  Used to spread a single seed over the whole state of the RandomGenerator
+//  First input: A reference to the splitmix64 state
+//  Returns the next 64 bit output
+static uint64_t SplitMix64(uint64_t &state) {
+  uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+//  Rotates a 64 bit integer left
+static uint64_t RotateLeft(uint64_t x, int k) {
+  return (x << k) | (x >> (64 - k));
+}
+
+//  A constructor for the RandomGenerator class
+//  First input: The seed from which the whole sequence is derived
+RandomGenerator::RandomGenerator(uint64_t seed) {
+  for (int i = 0; i < 4; ++i) this->state_[i] = SplitMix64(seed);
+}
+
+//  Returns the next 64 bit output of the generator
+//  Takes no inputs
+uint64_t RandomGenerator::NextU64() {
+  uint64_t result = RotateLeft(this->state_[1] * 5, 7) * 9;
+  uint64_t t = this->state_[1] << 17;
+  this->state_[2] ^= this->state_[0];
+  this->state_[3] ^= this->state_[1];
+  this->state_[1] ^= this->state_[2];
+  this->state_[0] ^= this->state_[3];
+  this->state_[2] ^= t;
+  this->state_[3] = RotateLeft(this->state_[3], 45);
+  return result;
+}
+
+//  Returns a double drawn uniformly from [0, 1) with 53 random bits
+//  Takes no inputs
+double RandomGenerator::NextDouble() {
+  return (this->NextU64() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+//  Returns a double drawn from the standard normal distribution (Box-Muller)
+//  Takes no inputs
+double RandomGenerator::NextNormal() {
+  double u1 = 1.0 - this->NextDouble();   //  in (0, 1] so that the logarithm is finite
+  double u2 = this->NextDouble();
+  return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+}
+
+//  Draws a value from the distribution by inverting its cumulative distribution function
+//  First input: A reference to the RandomGenerator to draw from
+//  Returns the drawn value
+double Distribution::Sample(RandomGenerator &random) const {
+  switch (this->kind) {
+  case DistributionKind::kConstant:
+    return this->first;
+  case DistributionKind::kUniform:
+    return this->first + (this->second - this->first) * random.NextDouble();
+  case DistributionKind::kExponential:
+    return -this->first * std::log(1.0 - random.NextDouble());
+  case DistributionKind::kPareto:
+    return this->first / std::pow(1.0 - random.NextDouble(), 1.0 / this->second);
+  case DistributionKind::kLognormal:
+    return std::exp(this->first + this->second * random.NextNormal());
+  }
+  return this->first;
+}
+
+//  Creates a distribution which always returns the same value
+//  First input: The value
+Distribution Distribution::Constant(double value) {
+  Distribution distribution = { DistributionKind::kConstant, value, 0.0 };
+  return distribution;
+}
+
+//  Creates an exponential distribution
+//  First input: The mean of the distribution
+Distribution Distribution::Exponential(double mean) {
+  Distribution distribution = { DistributionKind::kExponential, mean, 0.0 };
+  return distribution;
+}
+
+//  Creates a lognormal distribution
+//  First input: The mean of the logarithm of the values
+//  Second input: The standard deviation of the logarithm of the values
+Distribution Distribution::Lognormal(double mu, double sigma) {
+  Distribution distribution = { DistributionKind::kLognormal, mu, sigma };
+  return distribution;
+}
+
+//  Creates a Pareto distribution
+//  First input: The scale, which is the smallest value drawn
+//  Second input: The shape, smaller shapes give heavier tails
+Distribution Distribution::Pareto(double scale, double shape) {
+  Distribution distribution = { DistributionKind::kPareto, scale, shape };
+  return distribution;
+}
+
+//  Creates a uniform distribution
+//  First input: The smallest value
+//  Second input: The largest value
+Distribution Distribution::Uniform(double low, double high) {
+  Distribution distribution = { DistributionKind::kUniform, low, high };
+  return distribution;
+}
+
+//  A constructor for the WorkloadGenerator class
+//  First input: The seed of the random number generator
+//  Second input: A constant reference to the distribution of the time between arrivals
+//  Third input: A constant reference to a vector of the classes of processes to generate
+WorkloadGenerator::WorkloadGenerator(uint64_t seed, const Distribution &interarrival,
+  const vector<ProcessClass> &classes)
+  : seed_(seed), interarrival_(interarrival), classes_(classes) {
+  double total = 0.0;
+  for (vector<ProcessClass>::const_iterator it = classes.begin(); it != classes.end(); ++it)
+    total += it->weight;
+  double sum = 0.0;
+  for (vector<ProcessClass>::const_iterator it = classes.begin(); it != classes.end(); ++it) {
+    sum += it->weight;
+    this->cumulative_.push_back(total > 0.0 ? sum / total : 1.0);
+  }
+}
+
+//  Creates a generator for a bimodal mix of interactive and batch processes
+//  Interactive processes (80%) have many short, exponentially distributed CPU bursts
+//  and long IO bursts, batch processes (20%) have few Pareto distributed CPU bursts
+//  with a heavy tail and lognormal IO bursts
+//  Processes arrive as a Poisson process with a mean interarrival time of 10
+//  First input: The seed of the random number generator
+//  Returns the generator
+WorkloadGenerator WorkloadGenerator::InteractiveBatchMix(uint64_t seed) {
+  ProcessClass interactive = { 0.8, Distribution::Uniform(5, 20),
+    Distribution::Exponential(4), Distribution::Exponential(40) };
+  ProcessClass batch = { 0.2, Distribution::Uniform(2, 6),
+    Distribution::Pareto(20, 1.5), Distribution::Lognormal(3.4, 0.5) };
+  vector<ProcessClass> classes;
+  classes.push_back(interactive);
+  classes.push_back(batch);
+  return WorkloadGenerator(seed, Distribution::Exponential(10), classes);
+}
+
+//  Draws a burst time and rounds it to a whole number of ticks
+//  First input: A constant reference to the distribution of the burst
+//  Second input: A reference to the RandomGenerator to draw from
+//  Returns the burst, at least 1 and at most kMaxBurst
+int WorkloadGenerator::SampleBurst(const Distribution &distribution,
+  RandomGenerator &random) const {
+  double value = std::floor(distribution.Sample(random) + 0.5);
+  if (!(value >= 1.0)) return 1;
+  if (value > kMaxBurst) return static_cast<int>(kMaxBurst);
+  return static_cast<int>(value);
+}
+
+//  Adds generated processes to a workload
+//  Processes are named P1, P2, ... continuing after the processes already in the
+//  workload, and the first generated process arrives at time 0
+//  First input: The number of processes to generate
+//  Second input: A pointer to the Workload which receives the processes
+//  Returns nothing
+void WorkloadGenerator::Generate(size_t count, Workload *workload) {
+  if (this->classes_.empty()) return;
+  RandomGenerator random(this->seed_);
+  size_t first = workload->size();
+  workload->Reserve(count, 0);
+
+  vector<int> cpus;
+  vector<int> ios;
+  double arrival_time = 0.0;
+  for (size_t i = 0; i < count; ++i) {
+    //  pick the class of the process
+    double u = random.NextDouble();
+    size_t c = 0;
+    while (c + 1 < this->cumulative_.size() && u >= this->cumulative_[c]) ++c;
+    const ProcessClass &process_class = this->classes_[c];
+
+    //  draw the bursts, the process ends with a CPU burst
+    double bursts = std::floor(process_class.cpu_bursts.Sample(random) + 0.5);
+    int cpu_count = bursts < 1.0 ? 1 : bursts > kMaxBurstCount ?
+      static_cast<int>(kMaxBurstCount) : static_cast<int>(bursts);
+    cpus.clear();
+    ios.clear();
+    for (int j = 0; j < cpu_count; ++j) {
+      cpus.push_back(this->SampleBurst(process_class.cpu_burst, random));
+      if (j + 1 < cpu_count) ios.push_back(this->SampleBurst(process_class.io_burst, random));
+    }
+
+    workload->AddProcess("P" + to_string(first + i + 1),
+      arrival_time < kMaxBurst ? static_cast<int>(arrival_time) : static_cast<int>(kMaxBurst),
+      cpus, ios);
+    arrival_time += std::floor(this->interarrival_.Sample(random) + 0.5);
+  }
+}
\ No newline at end of file
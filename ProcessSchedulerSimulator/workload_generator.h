@@ -0,0 +1,89 @@
+#ifndef WORKLOAD_GENERATOR_H_
+#define WORKLOAD_GENERATOR_H_
+
+#include "workload.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+using std::size_t;
+using std::vector;
+
+//  A small, fast pseudo random number generator (xoshiro256**)
+//  Unlike the engines and distributions of <random> its output is fully specified,
+//  so the same seed produces the same workload with every compiler and library
+class RandomGenerator {
+public:
+  //  constructors
+  explicit RandomGenerator(uint64_t);
+
+  //  methods
+  double NextDouble();
+  double NextNormal();
+  uint64_t NextU64();
+
+private:
+  uint64_t state_[4];   //  the state of the generator
+};
+
+//  The kinds of distributions bursts and interarrival times may be drawn from
+enum class DistributionKind { kConstant, kUniform, kExponential, kPareto, kLognormal };
+
+//  A distribution of non-negative values described by its kind and two parameters
+//    kConstant:    always first
+//    kUniform:     uniform between first and second
+//    kExponential: exponential with mean first
+//    kPareto:      Pareto with scale (minimum) first and shape second
+//    kLognormal:   lognormal whose logarithm has mean first and standard deviation second
+struct Distribution {
+  DistributionKind kind;  //  the kind of the distribution
+  double first;           //  the first parameter
+  double second;          //  the second parameter
+
+  //  methods
+  double Sample(RandomGenerator &) const;
+
+  //  factories
+  static Distribution Constant(double value);
+  static Distribution Exponential(double mean);
+  static Distribution Lognormal(double mu, double sigma);
+  static Distribution Pareto(double scale, double shape);
+  static Distribution Uniform(double low, double high);
+};
+
+//  A class of processes in a generated workload, e.g. interactive or batch processes
+struct ProcessClass {
+  double weight;              //  relative share of the processes which belong to this class
+  Distribution cpu_bursts;    //  the number of CPU bursts of a process (at least 1)
+  Distribution cpu_burst;     //  the length of each CPU burst
+  Distribution io_burst;      //  the length of each IO burst
+};
+
+//  Generates workloads of processes whose bursts and arrivals are drawn from
+//  configurable distributions
+//  Every process alternates CPU and IO bursts, starting and ending with a CPU burst
+//  The same seed and configuration always generate the same workload
+class WorkloadGenerator {
+public:
+  //  constructors
+  WorkloadGenerator(uint64_t, const Distribution &, const vector<ProcessClass> &);
+
+  //  methods
+  void Generate(size_t, Workload *);
+  static WorkloadGenerator InteractiveBatchMix(uint64_t);
+
+  //  getters
+  const vector<ProcessClass> &classes() const { return this->classes_; }
+  const Distribution &interarrival() const { return this->interarrival_; }
+  uint64_t seed() const { return this->seed_; }
+
+private:
+  int SampleBurst(const Distribution &, RandomGenerator &) const;
+
+  uint64_t seed_;                   //  the seed of the random number generator
+  Distribution interarrival_;       //  the time between the arrivals of consecutive processes
+  vector<ProcessClass> classes_;    //  the classes of processes in the workload
+  vector<double> cumulative_;       //  cumulative weights of the classes, normalized to 1
+};
+
+#endif  //  WORKLOAD_GENERATOR_H_
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "workload.h"
+#include "workload_generator.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+//  Reads the whole of a string as a number
+//  First input: A pointer to the string
+//  Second input: A pointer to the number which is set
+//  Returns true if the string is a number
+//  Returns false otherwise
+static bool ParseNumber(const char *text, double *value) {
+  char *end;
+  *value = std::strtod(text, &end);
+  return end != text && *end == '\0';
+}
+
+//  Reads a distribution given as kind:first[,second], where the kind is one of
+//    const:value, uniform:low,high, exp:mean, pareto:scale,shape, lognormal:mu,sigma
+//  (see Distribution for the meaning of the parameters)
+//  First input: A constant reference to the description of the distribution
+//  Second input: A pointer to the distribution which is set
+//  Returns true if the description names a distribution with valid parameters
+//  Returns false otherwise
+static bool ParseDistribution(const string &option, Distribution *distribution) {
+  size_t colon = option.find(':');
+  if (colon == string::npos) return false;
+  string kind = option.substr(0, colon);
+  string parameters = option.substr(colon + 1);
+  size_t comma = parameters.find(',');
+  double first = 0.0;
+  double second = 0.0;
+  if (!ParseNumber(parameters.substr(0, comma).c_str(), &first)) return false;
+  bool two = comma != string::npos;
+  if (two && !ParseNumber(parameters.substr(comma + 1).c_str(), &second)) return false;
+
+  if (kind == "const" && !two && first >= 0.0) *distribution = Distribution::Constant(first);
+  else if (kind == "uniform" && two && first >= 0.0 && first <= second)
+    *distribution = Distribution::Uniform(first, second);
+  else if (kind == "exp" && !two && first > 0.0) *distribution = Distribution::Exponential(first);
+  else if (kind == "pareto" && two && first > 0.0 && second > 0.0)
+    *distribution = Distribution::Pareto(first, second);
+  else if (kind == "lognormal" && two && second >= 0.0)
+    *distribution = Distribution::Lognormal(first, second);
+  else return false;
+  return true;
+}
+
+//  Generates a workload of processes with random bursts and arrivals and writes it to a file
+//  Usage: GenerateWorkload [-n distribution] [-c distribution] [-i distribution]
+//                          [-a distribution | -r rate] process_count seed output [text|binary]
+//  Without -n, -c and -i the processes are the mix of interactive and batch processes of
+//  WorkloadGenerator::InteractiveBatchMix. With any of them every process is drawn from
+//  a single class whose
+//    -n is the distribution of the number of CPU bursts (default uniform:5,20)
+//    -c is the distribution of the length of a CPU burst (default exp:4)
+//    -i is the distribution of the length of an IO burst (default exp:40)
+//  -a is the distribution of the time between arrivals (default exp:10) and -r the rate
+//  of a Poisson arrival process, i.e. -a exp:1/rate
+//  The output is written as a binary workload file unless text is requested
+int main(int argc, char *argv[]) {
+  WorkloadGenerator mix = WorkloadGenerator::InteractiveBatchMix(0);
+  Distribution interarrival = mix.interarrival();
+  ProcessClass single = mix.classes().front();
+  single.weight = 1.0;
+  bool custom_class = false;
+  bool usage = false;
+
+  int first = 1;
+  for (; first < argc && argv[first][0] == '-' && argv[first][1] != '\0'; first += 2) {
+    string option = argv[first];
+    if (option != "-n" && option != "-c" && option != "-i" && option != "-a" && option != "-r") {
+      cerr << option << ": unknown option" << endl;
+      usage = true;
+      break;
+    }
+    if (first + 1 >= argc) {
+      cerr << option << ": missing value" << endl;
+      usage = true;
+      break;
+    }
+    const char *value = argv[first + 1];
+    bool valid;
+    if (option == "-n") valid = ParseDistribution(value, &single.cpu_bursts);
+    else if (option == "-c") valid = ParseDistribution(value, &single.cpu_burst);
+    else if (option == "-i") valid = ParseDistribution(value, &single.io_burst);
+    else if (option == "-a") valid = ParseDistribution(value, &interarrival);
+    else {
+      double rate = 0.0;
+      valid = ParseNumber(value, &rate) && rate > 0.0;
+      if (valid) interarrival = Distribution::Exponential(1.0 / rate);
+    }
+    if (!valid) {
+      cerr << option << " " << value << ": invalid value" << endl;
+      usage = true;
+    }
+    custom_class = custom_class || option == "-n" || option == "-c" || option == "-i";
+  }
+
+  int positional = argc - first;
+  string format = positional == 4 ? argv[first + 3] : "binary";
+  if (format != "text" && format != "binary") {
+    cerr << format << ": unknown format" << endl;
+    usage = true;
+  }
+  char *end = nullptr;
+  size_t count = 0;
+  uint64_t seed = 0;
+  if (!usage && (positional == 3 || positional == 4)) {
+    count = std::strtoull(argv[first], &end, 10);
+    if (*end != '\0') usage = true;
+    seed = std::strtoull(argv[first + 1], &end, 10);
+    if (*end != '\0') usage = true;
+  }
+  if (usage || (positional != 3 && positional != 4)) {
+    cerr << "Usage: " << argv[0] << " [-n distribution] [-c distribution] [-i distribution]"
+      << " [-a distribution | -r rate] process_count seed output [text|binary]" << endl
+      << "  distributions: const:value uniform:low,high exp:mean pareto:scale,shape"
+      << " lognormal:mu,sigma" << endl;
+    return 2;
+  }
+
+  vector<ProcessClass> classes = mix.classes();
+  if (custom_class) classes.assign(1, single);
+  Workload workload;
+  WorkloadGenerator generator(seed, interarrival, classes);
+  generator.Generate(count, &workload);
+
+  const char *output = argv[first + 2];
+  bool ok = format == "text" ? workload.SaveTextFile(output) : workload.SaveBinaryFile(output);
+  if (!ok) {
+    cerr << output << ": " << workload.error() << endl;
+    return 1;
+  }
+  cout << "Generated " << workload.size() << " processes" << endl;
+  return 0;
+}
@@ -0,0 +1,157 @@
+#include "workload_stream.h"
+
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <sys/types.h>
+
+//  A Process read from the stream, together with the storage its views point into
+//  The object is never moved, so the views stay valid while it is reused for other lines
+struct WorkloadStream::StreamedProcess : public Process {
+  vector<int> bursts;   //  the CPU bursts followed by the IO bursts
+  string name;          //  the name of the process
+  size_t slot;          //  the index of the process in admitted_ while it is admitted
+};
+
+//  A constructor for the WorkloadStream class
+//  Takes no inputs
+WorkloadStream::WorkloadStream()
+  : file_(nullptr), owns_file_(false), arrivals_(kQueueCapacity), retired_(kQueueCapacity),
+    done_(true), stop_(false), next_(nullptr), process_count_(0) {}
+
+//  A destructor for the WorkloadStream class
+//  Stops the producer and deletes every process the stream still holds
+WorkloadStream::~WorkloadStream() {
+  this->Stop();
+}
+
+//  Stops the producer thread, closes the file and deletes every process, including
+//  those admitted and not yet retired
+//  Takes no inputs
+//  Returns nothing
+void WorkloadStream::Stop() {
+  this->stop_.store(true, std::memory_order_relaxed);
+  if (this->producer_.joinable()) this->producer_.join();
+  if (this->file_ != nullptr && this->owns_file_) fclose(this->file_);
+  this->file_ = nullptr;
+  StreamedProcess *process;
+  while (this->arrivals_.TryPop(&process)) delete process;
+  while (this->retired_.TryPop(&process)) delete process;
+  for (vector<StreamedProcess *>::iterator it = this->admitted_.begin(); it != this->admitted_.end(); ++it)
+    delete *it;
+  this->admitted_.clear();
+  delete this->next_;
+  this->next_ = nullptr;
+}
+
+//  Starts streaming a text workload file
+//  First input: A constant reference to the path of the file, or "-" for standard input
+//  Returns true if the file was opened and the producer thread started
+//  Returns false if the file could not be opened, error() describes the problem
+bool WorkloadStream::Open(const string &path) {
+  this->Stop();
+  this->error_.clear();
+  this->process_count_ = 0;
+  this->owns_file_ = path != "-";
+  this->file_ = this->owns_file_ ? fopen(path.c_str(), "rb") : stdin;
+  if (this->file_ == nullptr) {
+    this->error_ = "could not open " + path;
+    return false;
+  }
+  this->stop_.store(false, std::memory_order_relaxed);
+  this->done_.store(false, std::memory_order_relaxed);
+  this->producer_ = std::thread(&WorkloadStream::Produce, this);
+  return true;
+}
+
+//  The loop of the producer thread
+//  Parses every line of the file into a process, reusing a retired process when one is
+//  available, and queues it, waiting while the queue is full. Stops at the end of the
+//  file, at the first malformed line, or when asked to stop.
+//  Takes no inputs
+//  Returns nothing
+void WorkloadStream::Produce() {
+  Workload line;    //  parses one line at a time, its storage is reused for every line
+  char *text = nullptr;
+  size_t capacity = 0;
+  ssize_t length;
+  size_t line_number = 0;
+  int last_arrival = 0;
+  while (!this->stop_.load(std::memory_order_relaxed) &&
+    (length = getline(&text, &capacity, this->file_)) >= 0) {
+    ++line_number;
+    const char *end = text + length;
+    if (end != text && end[-1] == '\n') --end;
+    line.Clear();
+    if (!line.AddTextLine(text, end, line_number)) {
+      this->error_ = line.error();
+      break;
+    }
+    if (line.size() == 0) continue;
+
+    StreamedProcess *process;
+    if (!this->retired_.TryPop(&process)) process = new StreamedProcess;
+    int cpu_count = line.cpu_count(0);
+    int io_count = line.io_count(0);
+    process->bursts.assign(line.cpu_bursts(0), line.cpu_bursts(0) + cpu_count + io_count);
+    process->name.assign(line.name_data(0), line.name_length(0));
+    static_cast<Process &>(*process) = Process(BurstList(process->bursts.data(), cpu_count),
+      BurstList(process->bursts.data() + cpu_count, io_count),
+      process->name.data(), static_cast<int>(process->name.size()), ProcessState::kNew);
+    if (line.arrival_time(0) > last_arrival) last_arrival = line.arrival_time(0);
+    process->set_arrival_time(last_arrival);
+    process->set_state(ProcessState::kNew);
+    ++this->process_count_;
+
+    while (!this->arrivals_.TryPush(process)) {
+      if (this->stop_.load(std::memory_order_relaxed)) {
+        delete process;
+        break;
+      }
+      std::this_thread::yield();
+    }
+  }
+  if (this->error_.empty() && ferror(this->file_)) this->error_ = "could not read the workload";
+  free(text);
+  this->done_.store(true, std::memory_order_release);
+}
+
+//  Finds the arrival time of the next process, waiting for the producer to read it
+//  Takes no inputs
+//  Returns the arrival time of the next process
+//  Returns INT_MAX once every process of the file has been admitted
+int WorkloadStream::NextArrival() {
+  while (this->next_ == nullptr && !this->arrivals_.TryPop(&this->next_)) {
+    //  the producer publishes its last process before done_, so check the queue once more
+    if (this->done_.load(std::memory_order_acquire)) {
+      if (this->arrivals_.TryPop(&this->next_)) break;
+      return INT_MAX;
+    }
+    std::this_thread::yield();
+  }
+  return this->next_->arrival_time();
+}
+
+//  Removes the next process from the stream
+//  Should only be called after NextArrival returned its arrival time
+//  Takes no inputs
+//  Returns a pointer to the Process, valid until it is passed to Retire
+Process *WorkloadStream::Admit() {
+  StreamedProcess *process = this->next_;
+  this->next_ = nullptr;
+  process->slot = this->admitted_.size();
+  this->admitted_.push_back(process);
+  return process;
+}
+
+//  Gives back a terminated process, whose storage is reused by the producer
+//  First input: A pointer to a Process returned by Admit
+//  Returns nothing
+void WorkloadStream::Retire(Process *retired) {
+  StreamedProcess *process = static_cast<StreamedProcess *>(retired);
+  StreamedProcess *last = this->admitted_.back();
+  this->admitted_[process->slot] = last;
+  last->slot = process->slot;
+  this->admitted_.pop_back();
+  if (!this->retired_.TryPush(process)) delete process;
+}
@@ -0,0 +1,70 @@
+#ifndef WORKLOAD_STREAM_H_
+#define WORKLOAD_STREAM_H_
+
+#include "arrival_stream.h"
+#include "process.h"
+#include "spsc_queue.h"
+#include "workload.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+using std::size_t;
+using std::string;
+using std::vector;
+
+//  Streams the processes of a text workload file (or of standard input) into a
+//  simulation while it runs
+//  A producer thread reads and parses the file one line at a time and hands each
+//  process to the simulation through a lock free SpscQueue, so reading overlaps with
+//  simulating and only the processes which are queued or not yet terminated are held
+//  in memory. Terminated processes go back to the producer through a second queue and
+//  their storage is reused for the following lines.
+//  Processes must be listed in order of their arrival times. A process listed with an
+//  earlier arrival time than the one before it arrives together with that one.
+//  NOTE: NextArrival, Admit and Retire must all be called from the same thread
+class WorkloadStream : public ArrivalStream {
+public:
+  static const size_t kQueueCapacity = 4096;  //  processes read ahead of the simulation
+
+  //  constructors
+  WorkloadStream();
+  ~WorkloadStream();
+
+  //  methods
+  Process *Admit();
+  int NextArrival();
+  bool Open(const string &);
+  void Retire(Process *);
+
+  //  getters
+  //  NOTE: only valid once NextArrival has returned INT_MAX
+  const string &error() const { return this->error_; }
+  size_t process_count() const { return this->process_count_; }
+
+private:
+  WorkloadStream(const WorkloadStream &);               //  not copyable, owns a thread
+  WorkloadStream &operator=(const WorkloadStream &);    //  not copyable, owns a thread
+
+  struct StreamedProcess;
+
+  void Produce();
+  void Stop();
+
+  FILE *file_;                              //  the file being read (nullptr once closed)
+  bool owns_file_;                          //  whether file_ is closed by the stream (false for stdin)
+  std::thread producer_;                    //  the thread which reads the file
+  SpscQueue<StreamedProcess *> arrivals_;   //  parsed processes, from the producer to the simulation
+  SpscQueue<StreamedProcess *> retired_;    //  terminated processes, from the simulation to the producer
+  std::atomic<bool> done_;                  //  set by the producer once it has queued its last process
+  std::atomic<bool> stop_;                  //  set to make the producer give up early
+  StreamedProcess *next_;                   //  the next process, taken from arrivals_ but not admitted
+  vector<StreamedProcess *> admitted_;      //  the admitted processes which have not been retired
+  size_t process_count_;                    //  the number of processes read (written by the producer)
+  string error_;                            //  description of a read or parse failure (written by the producer)
+};
+
+#endif  //  WORKLOAD_STREAM_H_